@@ -9,11 +9,15 @@ class allocator_with_fit_mode:
 
 public:
     
+    /** next_fit resumes the search from where the previous allocation stopped,
+     *  allocators without a roving pointer treat it as first_fit
+     */
     enum class fit_mode
     {
         first_fit,
         the_best_fit,
-        the_worst_fit
+        the_worst_fit,
+        next_fit
     };
 
 public:
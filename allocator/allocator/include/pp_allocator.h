@@ -5,18 +5,42 @@
 #ifndef MP_OS_PP_ALLOCATOR_H
 #define MP_OS_PP_ALLOCATOR_H
 
+#include <cstddef>
 #include <memory_resource>
 #include <memory>
 
 struct smart_mem_resource : public std::pmr::memory_resource
 {
+protected:
+
+    /** size rounded up to a multiple of alignment, which is a power of two
+     */
+    static constexpr size_t align_up(size_t size, size_t alignment = alignof(std::max_align_t)) noexcept
+    {
+        return (size + alignment - 1) & ~(alignment - 1);
+    }
+
 private:
     virtual void do_deallocate_sm(void*) =0;
 
+    /** Releases block got from do_allocate_sm(size_t, size_t) with the same alignment
+     */
+    virtual void do_deallocate_sm(void* at, size_t alignment);
+
     void do_deallocate(void* p, size_t, size_t) final;
 
+    /** Storage returned has to be aligned to alignof(std::max_align_t), so every weaker alignment is met
+     */
     virtual void* do_allocate_sm(size_t) =0;
 
+    /** Serves alignments stricter than alignof(std::max_align_t), weaker ones go to do_allocate_sm(size_t).
+     *  Default one takes size + alignment bytes from do_allocate_sm(size_t) and keeps the returned pointer
+     *  right before the aligned payload, allocators override it to place aligned payloads themselves
+     */
+    virtual void* do_allocate_sm(size_t size, size_t alignment);
+
+    /** @throw std::invalid_argument if _Align is not a power of two
+     */
     void * do_allocate(size_t _Bytes, size_t _Align) final;
 };
 
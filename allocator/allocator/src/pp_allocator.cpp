@@ -3,16 +3,54 @@
 //
 
 #include "pp_allocator.h"
+#include <bit>
+#include <cstdint>
+#include <limits>
+#include <new>
+#include <stdexcept>
 
 
-void smart_mem_resource::do_deallocate(void* p, size_t, size_t)
+void smart_mem_resource::do_deallocate(void* p, size_t, size_t _Align)
 {
-    do_deallocate_sm(p);
+    if (_Align <= alignof(std::max_align_t))
+    {
+        do_deallocate_sm(p);
+    }
+    else
+    {
+        do_deallocate_sm(p, _Align);
+    }
 }
 
 void * smart_mem_resource::do_allocate(size_t _Bytes, size_t _Align)
 {
-    return do_allocate_sm(_Bytes);
+    if (!std::has_single_bit(_Align))
+    {
+        throw std::invalid_argument("alignment must be a power of two");
+    }
+
+    return _Align <= alignof(std::max_align_t) ? do_allocate_sm(_Bytes) : do_allocate_sm(_Bytes, _Align);
+}
+
+void smart_mem_resource::do_deallocate_sm(void* at, size_t)
+{
+    do_deallocate_sm(static_cast<void**>(at)[-1]);
+}
+
+void* smart_mem_resource::do_allocate_sm(size_t size, size_t alignment)
+{
+    if (size > std::numeric_limits<size_t>::max() - alignment - sizeof(void*))
+    {
+        throw std::bad_alloc();
+    }
+
+    void* block = do_allocate_sm(size + alignment - 1 + sizeof(void*));
+
+    auto payload = reinterpret_cast<std::uintptr_t>(block) + sizeof(void*);
+    payload = (payload + alignment - 1) & ~(alignment - 1);
+
+    reinterpret_cast<void**>(payload)[-1] = block;
+    return reinterpret_cast<void*>(payload);
 }
 
 void* test_mem_resource::do_allocate_sm(size_t n)
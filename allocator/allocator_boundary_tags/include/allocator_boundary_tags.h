@@ -6,6 +6,8 @@
 #include <pp_allocator.h>
 #include <logger_guardant.h>
 #include <typename_holder.h>
+#include <array>
+#include <cstdint>
 #include <iterator>
 #include <mutex>
 
@@ -39,7 +41,34 @@ private:
         }
     };
 
-    struct allocator_metadata
+    /** Header of an indexed free gap, placed at the gap start. Gaps too small for a block header are not indexed
+     */
+    struct free_block_metadata
+    {
+        size_t size_;
+        free_block_metadata* next_free_;
+        free_block_metadata* prev_free_;
+
+        /** Occupied block before the gap, trusted memory for the gap before the first block
+         */
+        block_metadata* prev_;
+    };
+
+    /** Free gaps are binned TLSF-style: by the highest bit of the gap size
+     *  and then by the next second_level_log2 bits, so bins cover contiguous growing size ranges
+     */
+    static constexpr const size_t second_level_log2 = 3;
+
+    static constexpr const size_t second_level_count = size_t(1) << second_level_log2;
+
+    static constexpr const size_t bins_count = (sizeof(size_t) * 8 - second_level_log2 + 1) * second_level_count;
+
+    static constexpr const size_t bins_bitmap_words = (bins_count + 63) / 64;
+
+    /** Blocks start at max_align_t boundaries: the arena follows metadata aligned to it,
+     *  block headers and payload sizes are multiples of it
+     */
+    struct alignas(std::max_align_t) allocator_metadata
     {
         logger* logger_;
 
@@ -54,12 +83,18 @@ private:
 
         memory_resource* allocator_;
 
+        std::array<std::uint64_t, bins_bitmap_words> bins_bitmap_;
+
+        std::array<free_block_metadata*, bins_count> bins_;
+
         const std::byte* allocator_end() const noexcept
         {
             return reinterpret_cast<const std::byte*>(this) + sizeof(allocator_metadata) + mem_size_;
         }
     };
 
+    static_assert(sizeof(block_metadata) % alignof(std::max_align_t) == 0);
+
     static constexpr const size_t occupied_block_metadata_size = sizeof(size_t) + sizeof(void*) + sizeof(void*) + sizeof(void*);
     void *_trusted_memory;
 
@@ -95,6 +130,16 @@ public:
     void do_deallocate_sm(
             void *at) override;
 
+    /** Block header is placed so that the payload is aligned, padding before it stays a free gap
+     */
+    [[nodiscard]] void *do_allocate_sm(
+            size_t bytes,
+            size_t alignment) override;
+
+    void do_deallocate_sm(
+            void *at,
+            size_t alignment) override;
+
     bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override;
 
 public:
@@ -121,16 +166,56 @@ private:
 
     static inline const allocator_metadata& get_allocator_metadata(const void* trusted) noexcept;
 
-    inline block_metadata* get_block_first_fit(size_t size) const noexcept;
+    /** Payload size is rounded up to max_align_t here, after it is checked against the space size
+     */
+    void *allocate_block(size_t size, size_t alignment);
+
+    /** TLSF good fit, also used for first_fit and next_fit: head of the request's own bin if it fits,
+     *  otherwise head of the next non-empty bin, which fits unless alignment padding does not.
+     *  Only bin heads are looked at, so lookup does not depend on the number of gaps
+     */
+    inline block_metadata* get_block_best_fit(size_t size, size_t alignment) const noexcept;
+
+    /** Head of the highest non-empty bin the request fits into
+     */
+    inline block_metadata* get_block_worst_fit(size_t size, size_t alignment) const noexcept;
+
+    /** Walks whole bins, only when no bin head fits: a request fails only if no gap fits it
+     */
+    inline block_metadata* get_block_any_fit(size_t size, size_t alignment) const noexcept;
 
-    inline block_metadata* get_block_best_fit(size_t size) const noexcept;
+    /** First byte of free gap after block, block is trusted memory for the gap before the first block
+     */
+    static inline std::byte* get_free_block_start(void* trusted, const block_metadata* block) noexcept;
 
-    inline block_metadata* get_block_worst_fit(size_t size) const noexcept;
+    /** Header position in the gap after block giving payload aligned to alignment
+     */
+    static inline block_metadata* get_aligned_block(void* trusted, const block_metadata* block, size_t alignment) noexcept;
+
+    /** Whether block of size bytes with header included fits into the gap after block with payload aligned
+     */
+    static inline bool fits(void* trusted, const block_metadata* block, size_t size, size_t alignment) noexcept;
 
     inline size_t get_next_free_block_size(const block_metadata* block) const noexcept;
 
     static inline size_t get_next_free_block_size(void* trusted, const block_metadata* block) noexcept;
 
+    static inline size_t get_bin_index(size_t size) noexcept;
+
+    /** First non-empty bin starting from from, bins_count if there is none
+     */
+    inline size_t get_next_bin(size_t from) const noexcept;
+
+    /** Last non-empty bin before to, bins_count if there is none
+     */
+    inline size_t get_prev_bin(size_t to) const noexcept;
+
+    /** Puts the gap after block into its bin if a block header fits into it
+     */
+    inline void insert_free_block(block_metadata* block) noexcept;
+
+    inline void remove_free_block(block_metadata* block) noexcept;
+
     inline size_t get_available_memory() const noexcept;
 
     class boundary_iterator
@@ -1,12 +1,14 @@
 #include <not_implemented.h>
 #include "../include/allocator_boundary_tags.h"
 #include <format>
+#include <cstdint>
+#include <bit>
 
 allocator_boundary_tags::~allocator_boundary_tags()
 {
     auto& metadata = get_allocator_metadata();
     metadata.mutex_.~mutex();
-    metadata.allocator_->deallocate(_trusted_memory, sizeof(allocator_metadata) + metadata.mem_size_, 1);
+    metadata.allocator_->deallocate(_trusted_memory, sizeof(allocator_metadata) + metadata.mem_size_);
 }
 
 allocator_boundary_tags::allocator_boundary_tags(
@@ -39,7 +41,7 @@ allocator_boundary_tags::allocator_boundary_tags(
 
     const auto allocator = parent_allocator != nullptr ? parent_allocator : std::pmr::get_default_resource();
 
-    _trusted_memory = allocator->allocate(sizeof(allocator_metadata) + space_size, 1);
+    _trusted_memory = allocator->allocate(sizeof(allocator_metadata) + space_size);
 
     const auto metadata = static_cast<allocator_metadata*>(_trusted_memory);
 
@@ -48,18 +50,50 @@ allocator_boundary_tags::allocator_boundary_tags(
     metadata->mem_size_ = space_size;
     metadata->first_block_ = nullptr;
     metadata->allocator_ = allocator;
+    metadata->bins_bitmap_.fill(0);
+    metadata->bins_.fill(nullptr);
 
     std::construct_at(&metadata->mutex_);
+
+    insert_free_block(static_cast<block_metadata*>(_trusted_memory));
 }
 
 [[nodiscard]] void *allocator_boundary_tags::do_allocate_sm(
         size_t size)
 {
-    size_t total_size = size + sizeof(block_metadata);
-    debug_with_guard(std::format("[*] allocating {} bytes", total_size));
+    return allocate_block(size, alignof(std::max_align_t));
+}
+
+[[nodiscard]] void *allocator_boundary_tags::do_allocate_sm(
+        size_t size,
+        size_t alignment)
+{
+    return allocate_block(size, alignment);
+}
 
+void allocator_boundary_tags::do_deallocate_sm(
+        void *at,
+        size_t)
+{
+    do_deallocate_sm(at);
+}
+
+void *allocator_boundary_tags::allocate_block(
+        size_t size,
+        size_t alignment)
+{
     auto& metadata = get_allocator_metadata();
 
+    if (size > metadata.mem_size_ || alignment > metadata.mem_size_)
+    {
+        error_with_guard([&] { return std::format(
+                "[!] out of memory: requested {} bytes aligned to {}", size, alignment); });
+        throw std::bad_alloc();
+    }
+
+    size_t total_size = align_up(size) + sizeof(block_metadata);
+    debug_with_guard([&] { return std::format("[*] allocating {} bytes", total_size); });
+
     std::lock_guard lock(metadata.mutex_);
 
     block_metadata* block = nullptr;
@@ -67,43 +101,35 @@ allocator_boundary_tags::allocator_boundary_tags(
     switch (metadata.fit_mode_)
     {
         case fit_mode::first_fit:
-            block = get_block_first_fit(total_size);
-            break;
+        case fit_mode::next_fit:
         case fit_mode::the_best_fit:
-            block = get_block_best_fit(total_size);
+            block = get_block_best_fit(total_size, alignment);
             break;
         case fit_mode::the_worst_fit:
-            block = get_block_worst_fit(total_size);
+            block = get_block_worst_fit(total_size, alignment);
             break;
     }
 
     if (block == nullptr)
     {
-        error_with_guard(std::format(
-                "[!] out of memory: requested {} bytes", total_size));
+        error_with_guard([&] { return std::format(
+                "[!] out of memory: requested {} bytes", total_size); });
         throw std::bad_alloc();
     }
 
-    const size_t free_block_size = get_next_free_block_size(block);
-
-    if (free_block_size < total_size + sizeof(block_metadata))
-    {
-        warning_with_guard(std::format(
-                "[*] changing block size to {} bytes", free_block_size));
-        total_size = free_block_size;
-    }
+    remove_free_block(block);
 
-    block_metadata* free_block;
+    block_metadata* free_block = get_aligned_block(_trusted_memory, block, alignment);
     bool iter_begin = block == _trusted_memory;
 
-    if (iter_begin)
-    {
-        free_block = reinterpret_cast<block_metadata*>(
-                static_cast<std::byte*>(_trusted_memory) + sizeof(allocator_metadata));
-    }
-    else
+    const size_t free_block_size = get_next_free_block_size(block)
+            - (reinterpret_cast<std::byte*>(free_block) - get_free_block_start(_trusted_memory, block));
+
+    if (free_block_size < total_size + sizeof(block_metadata))
     {
-        free_block = reinterpret_cast<block_metadata*>(block->block_end());
+        warning_with_guard([&] { return std::format(
+                "[*] changing block size to {} bytes", free_block_size); });
+        total_size = free_block_size;
     }
 
     free_block->block_size_ = total_size - sizeof(block_metadata);
@@ -126,12 +152,15 @@ allocator_boundary_tags::allocator_boundary_tags(
         free_block->prev_->next_ = free_block;
     }
 
-    debug_with_guard(std::format(
+    insert_free_block(block);
+    insert_free_block(free_block);
+
+    debug_with_guard([&] { return std::format(
             "[+] allocated {} bytes at {:p}",
-            total_size, static_cast<void*>(free_block + 1)));
-    information_with_guard(std::format(
-            "[*] available memory: {}", get_available_memory()));
-    debug_with_guard(print_blocks());
+            total_size, static_cast<void*>(free_block + 1)); });
+    information_with_guard([&] { return std::format(
+            "[*] available memory: {}", get_available_memory()); });
+    debug_with_guard([&] { return print_blocks(); });
 
     return free_block + 1;
 }
@@ -146,7 +175,7 @@ inline void allocator_boundary_tags::set_first_block(void *block)
 void allocator_boundary_tags::do_deallocate_sm(
         void *at)
 {
-    debug_with_guard(std::format("[*] deallocating block {:p}", at));
+    debug_with_guard([&] { return std::format("[*] deallocating block {:p}", at); });
 
     auto& metadata = get_allocator_metadata();
 
@@ -157,13 +186,15 @@ void allocator_boundary_tags::do_deallocate_sm(
 
     if (block->tm_ptr_ != _trusted_memory)
     {
-        error_with_guard(std::format(
-                "[!] block doesn't belong to this allocator: {:p}", at));
+        error_with_guard([&] { return std::format(
+                "[!] block doesn't belong to this allocator: {:p}", at); });
         throw std::logic_error("unknown block");
     }
 
-    debug_with_guard(get_dump(static_cast<char*>(at), block->block_size_));
+    debug_with_guard([&] { return get_dump(static_cast<char*>(at), block->block_size_); });
 
+    remove_free_block(block->prev_);
+    remove_free_block(block);
 
     if (block->prev_ == _trusted_memory)
     {
@@ -179,13 +210,15 @@ void allocator_boundary_tags::do_deallocate_sm(
         block->next_->prev_ = block->prev_;
     }
 
+    insert_free_block(block->prev_);
+
 
 
 
     debug_with_guard("[+] block deallocated successfully");
-    information_with_guard(std::format(
-            "[*] available memory: {}", get_available_memory()));
-    debug_with_guard(print_blocks());
+    information_with_guard([&] { return std::format(
+            "[*] available memory: {}", get_available_memory()); });
+    debug_with_guard([&] { return print_blocks(); });
 }
 
 inline void allocator_boundary_tags::set_fit_mode(
@@ -204,10 +237,13 @@ inline void allocator_boundary_tags::set_fit_mode(
         case fit_mode::the_worst_fit:
             fit_mode_string = "the_worst_fit";
             break;
+        case fit_mode::next_fit:
+            fit_mode_string = "next_fit";
+            break;
     }
 
-    debug_with_guard(std::format(
-            "[*] setting fit mode: {}", fit_mode_string));
+    debug_with_guard([&] { return std::format(
+            "[*] setting fit mode: {}", fit_mode_string); });
 
     auto& metadata = get_allocator_metadata();
     std::lock_guard lock(metadata.mutex_);
@@ -249,47 +285,195 @@ const allocator_boundary_tags::allocator_metadata& allocator_boundary_tags::get_
     return *static_cast<const allocator_metadata*>(trusted);
 }
 
-inline allocator_boundary_tags::block_metadata* allocator_boundary_tags::get_block_first_fit(size_t size) const noexcept
+inline std::byte* allocator_boundary_tags::get_free_block_start(void* trusted, const block_metadata* block) noexcept
 {
-    for (auto it = begin(); it != end(); ++it)
+    return block == trusted
+           ? static_cast<std::byte*>(trusted) + sizeof(allocator_metadata)
+           : const_cast<block_metadata*>(block)->block_end();
+}
+
+inline allocator_boundary_tags::block_metadata* allocator_boundary_tags::get_aligned_block(
+        void* trusted, const block_metadata* block, size_t alignment) noexcept
+{
+    auto payload = reinterpret_cast<std::uintptr_t>(get_free_block_start(trusted, block)) + sizeof(block_metadata);
+    payload = (payload + alignment - 1) & ~(alignment - 1);
+
+    return reinterpret_cast<block_metadata*>(payload - sizeof(block_metadata));
+}
+
+inline bool allocator_boundary_tags::fits(void* trusted, const block_metadata* block, size_t size, size_t alignment) noexcept
+{
+    const size_t padding = reinterpret_cast<std::byte*>(get_aligned_block(trusted, block, alignment))
+            - get_free_block_start(trusted, block);
+
+    return get_next_free_block_size(trusted, block) >= size + padding;
+}
+
+inline allocator_boundary_tags::block_metadata* allocator_boundary_tags::get_block_best_fit(size_t size, size_t alignment) const noexcept
+{
+    const auto& metadata = get_allocator_metadata();
+    const size_t min_bin = get_bin_index(size);
+
+    for (size_t bin = get_next_bin(min_bin); bin < bins_count; bin = get_next_bin(bin + 1))
+    {
+        if (fits(_trusted_memory, metadata.bins_[bin]->prev_, size, alignment))
+        {
+            return metadata.bins_[bin]->prev_;
+        }
+    }
+
+    return get_block_any_fit(size, alignment);
+}
+
+inline allocator_boundary_tags::block_metadata* allocator_boundary_tags::get_block_worst_fit(size_t size, size_t alignment) const noexcept
+{
+    const auto& metadata = get_allocator_metadata();
+    const size_t min_bin = get_bin_index(size);
+
+    for (size_t bin = get_prev_bin(bins_count); bin < bins_count && bin >= min_bin; bin = get_prev_bin(bin))
     {
-        if (!it.occupied() && it.size() >= size)
+        if (fits(_trusted_memory, metadata.bins_[bin]->prev_, size, alignment))
         {
-            return static_cast<block_metadata*>(it.get_ptr());
+            return metadata.bins_[bin]->prev_;
+        }
+    }
+
+    return get_block_any_fit(size, alignment);
+}
+
+inline allocator_boundary_tags::block_metadata* allocator_boundary_tags::get_block_any_fit(size_t size, size_t alignment) const noexcept
+{
+    const auto& metadata = get_allocator_metadata();
+
+    for (size_t bin = get_next_bin(get_bin_index(size)); bin < bins_count; bin = get_next_bin(bin + 1))
+    {
+        for (auto free_block = metadata.bins_[bin]; free_block != nullptr; free_block = free_block->next_free_)
+        {
+            if (fits(_trusted_memory, free_block->prev_, size, alignment))
+            {
+                return free_block->prev_;
+            }
         }
     }
 
     return nullptr;
 }
 
-inline allocator_boundary_tags::block_metadata* allocator_boundary_tags::get_block_best_fit(size_t size) const noexcept
+inline size_t allocator_boundary_tags::get_bin_index(size_t size) noexcept
 {
-    boundary_iterator result;
+    const size_t first_level = std::bit_width(size) - 1;
 
-    for (auto it = begin(); it != end(); ++it)
+    if (first_level < second_level_log2)
+    {
+        return size;
+    }
+
+    return (first_level - second_level_log2 + 1) * second_level_count
+           + ((size >> (first_level - second_level_log2)) & (second_level_count - 1));
+}
+
+inline size_t allocator_boundary_tags::get_next_bin(size_t from) const noexcept
+{
+    const auto& bitmap = get_allocator_metadata().bins_bitmap_;
+
+    for (size_t word = from / 64; word < bins_bitmap_words; ++word)
     {
-        if (!it.occupied() && it.size() >= size && (it.size() < result.size() || result.get_ptr() == nullptr))
+        std::uint64_t bits = bitmap[word];
+
+        if (word == from / 64)
+        {
+            bits &= ~std::uint64_t(0) << (from % 64);
+        }
+
+        if (bits != 0)
         {
-            result = it;
+            return word * 64 + std::countr_zero(bits);
         }
     }
 
-    return static_cast<block_metadata*>(result.get_ptr());
+    return bins_count;
 }
 
-inline allocator_boundary_tags::block_metadata* allocator_boundary_tags::get_block_worst_fit(size_t size) const noexcept
+inline size_t allocator_boundary_tags::get_prev_bin(size_t to) const noexcept
 {
-    boundary_iterator result;
+    const auto& bitmap = get_allocator_metadata().bins_bitmap_;
 
-    for (auto it = begin(); it != end(); ++it)
+    for (size_t word = to / 64 + 1; word-- > 0;)
     {
-        if (!it.occupied() && it.size() >= size && it.size() > result.size())
+        std::uint64_t bits = bitmap[word];
+
+        if (word == to / 64)
+        {
+            bits &= (std::uint64_t(1) << (to % 64)) - 1;
+        }
+
+        if (bits != 0)
         {
-            result = it;
+            return word * 64 + 63 - std::countl_zero(bits);
         }
     }
 
-    return static_cast<block_metadata*>(result.get_ptr());
+    return bins_count;
+}
+
+inline void allocator_boundary_tags::insert_free_block(block_metadata* block) noexcept
+{
+    const size_t size = get_next_free_block_size(block);
+
+    if (size < sizeof(block_metadata))
+    {
+        return;
+    }
+
+    auto& metadata = get_allocator_metadata();
+    auto free_block = reinterpret_cast<free_block_metadata*>(get_free_block_start(_trusted_memory, block));
+    const size_t bin = get_bin_index(size);
+
+    free_block->size_ = size;
+    free_block->prev_ = block;
+    free_block->prev_free_ = nullptr;
+    free_block->next_free_ = metadata.bins_[bin];
+
+    if (free_block->next_free_ != nullptr)
+    {
+        free_block->next_free_->prev_free_ = free_block;
+    }
+
+    metadata.bins_[bin] = free_block;
+    metadata.bins_bitmap_[bin / 64] |= std::uint64_t(1) << (bin % 64);
+}
+
+inline void allocator_boundary_tags::remove_free_block(block_metadata* block) noexcept
+{
+    const size_t size = get_next_free_block_size(block);
+
+    if (size < sizeof(block_metadata))
+    {
+        return;
+    }
+
+    auto& metadata = get_allocator_metadata();
+    auto free_block = reinterpret_cast<free_block_metadata*>(get_free_block_start(_trusted_memory, block));
+    const size_t bin = get_bin_index(size);
+
+    if (free_block->prev_free_ != nullptr)
+    {
+        free_block->prev_free_->next_free_ = free_block->next_free_;
+    }
+    else
+    {
+        metadata.bins_[bin] = free_block->next_free_;
+    }
+
+    if (free_block->next_free_ != nullptr)
+    {
+        free_block->next_free_->prev_free_ = free_block->prev_free_;
+    }
+
+    if (metadata.bins_[bin] == nullptr)
+    {
+        metadata.bins_bitmap_[bin / 64] &= ~(std::uint64_t(1) << (bin % 64));
+    }
 }
 
 inline size_t allocator_boundary_tags::get_next_free_block_size(const block_metadata* block) const noexcept
@@ -1,4 +1,9 @@
 #include <gtest/gtest.h>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <tuple>
+#include <vector>
 #include <allocator_dbg_helper.h>
 #include <allocator_boundary_tags.h>
 #include <client_logger_builder.h>
@@ -38,14 +43,15 @@ TEST(positiveTests, test1)
                 logger::severity::information
             }
         }));
-    std::unique_ptr<smart_mem_resource> subject(new allocator_boundary_tags(sizeof(int) * 70, nullptr, logger.get(), allocator_with_fit_mode::fit_mode::first_fit));
+    std::unique_ptr<smart_mem_resource> subject(new allocator_boundary_tags(sizeof(int) * 96, nullptr, logger.get(), allocator_with_fit_mode::fit_mode::first_fit));
     
+    // payload sizes are rounded up to alignof(std::max_align_t): 10 ints take 12
     auto *first_block = reinterpret_cast<int *>(subject->allocate(sizeof(int) * 10));
     auto *second_block = reinterpret_cast<int *>(subject->allocate(sizeof(int) * 10));
     auto *third_block = reinterpret_cast<int *>(subject->allocate(sizeof(int) * 10));
     
-    ASSERT_EQ(reinterpret_cast<int*>(reinterpret_cast<char*>(first_block + 10) + sizeof(size_t) + sizeof(void*) * 3), second_block);
-    ASSERT_EQ(reinterpret_cast<int*>(reinterpret_cast<char*>(second_block + 10) + sizeof(size_t) + sizeof(void*) * 3), third_block);
+    ASSERT_EQ(reinterpret_cast<int*>(reinterpret_cast<char*>(first_block + 12) + sizeof(size_t) + sizeof(void*) * 3), second_block);
+    ASSERT_EQ(reinterpret_cast<int*>(reinterpret_cast<char*>(second_block + 12) + sizeof(size_t) + sizeof(void*) * 3), third_block);
     
     subject->deallocate(const_cast<void *>(reinterpret_cast<void const *>(second_block)), 1);
     
@@ -55,8 +61,9 @@ TEST(positiveTests, test1)
     the_same_subject->set_fit_mode(allocator_with_fit_mode::fit_mode::the_best_fit);
     auto *fifth_block = reinterpret_cast<int *>(subject->allocate(sizeof(int) * 1));
     
-    ASSERT_EQ(reinterpret_cast<int*>(reinterpret_cast<char*>(first_block + 10) + sizeof(size_t) + sizeof(void*) * 3), fourth_block);
-    ASSERT_EQ(reinterpret_cast<int*>(reinterpret_cast<char*>(fourth_block + 1) + sizeof(size_t) + sizeof(void*) * 3), fifth_block);
+    // the tail is the bigger gap, what is left of it is still bigger than the gap of the second block
+    ASSERT_EQ(reinterpret_cast<int*>(reinterpret_cast<char*>(third_block + 12) + sizeof(size_t) + sizeof(void*) * 3), fourth_block);
+    ASSERT_EQ(second_block, fifth_block);
     
     subject->deallocate(const_cast<void *>(reinterpret_cast<void const *>(first_block)), 1);
     subject->deallocate(const_cast<void *>(reinterpret_cast<void const *>(third_block)), 1);
@@ -83,9 +90,10 @@ TEST(positiveTests, test2)
     auto actual_blocks_state = dynamic_cast<allocator_test_utils *>(allocator_instance.get())->get_blocks_info();
     std::vector<allocator_test_utils::block_info> expected_blocks_state
         {
-            { .block_size = 1000 + sizeof(allocator_dbg_helper::block_size_t) + sizeof(allocator_dbg_helper::block_pointer_t) * 3, .is_block_occupied = true },
+            // 1000 bytes are rounded up to alignof(std::max_align_t)
+            { .block_size = 1008 + sizeof(allocator_dbg_helper::block_size_t) + sizeof(allocator_dbg_helper::block_pointer_t) * 3, .is_block_occupied = true },
             { .block_size = sizeof(allocator_dbg_helper::block_size_t) + sizeof(allocator_dbg_helper::block_pointer_t) * 3, .is_block_occupied = true },
-            { .block_size = 3000 - (1000 + (sizeof(allocator_dbg_helper::block_size_t) + sizeof(allocator_dbg_helper::block_pointer_t) * 3) * 2), .is_block_occupied = false }
+            { .block_size = 3000 - (1008 + (sizeof(allocator_dbg_helper::block_size_t) + sizeof(allocator_dbg_helper::block_pointer_t) * 3) * 2), .is_block_occupied = false }
         };
     
     ASSERT_EQ(actual_blocks_state.size(), expected_blocks_state.size());
@@ -98,6 +106,209 @@ TEST(positiveTests, test2)
     allocator_instance->deallocate(second_block, 1);
 }
 
+TEST(positiveTests, test3)
+{
+    std::unique_ptr<logger> logger_instance(create_logger(std::vector<std::pair<std::string, logger::severity>>
+        {
+            {
+                "allocator_boundary_tags_tests_logs_positive_test_aligned.txt",
+                logger::severity::information
+            }
+        }));
+    std::unique_ptr<smart_mem_resource> allocator_instance(new allocator_boundary_tags(3000, nullptr, logger_instance.get(), allocator_with_fit_mode::fit_mode::first_fit));
+    
+    auto *first_block = reinterpret_cast<char *>(allocator_instance->allocate(sizeof(char) * 3));
+    auto *second_block = reinterpret_cast<char *>(allocator_instance->allocate(sizeof(char) * 100, 64));
+    auto *third_block = reinterpret_cast<char *>(allocator_instance->allocate(sizeof(char) * 10, 256));
+    
+    ASSERT_EQ(reinterpret_cast<std::uintptr_t>(second_block) % 64, 0);
+    ASSERT_EQ(reinterpret_cast<std::uintptr_t>(third_block) % 256, 0);
+    ASSERT_GE(second_block, first_block + 3);
+    ASSERT_GE(third_block, second_block + 100);
+    
+    allocator_instance->deallocate(second_block, 1, 64);
+    allocator_instance->deallocate(first_block, 1);
+    allocator_instance->deallocate(third_block, 1, 256);
+    
+    auto actual_blocks_state = dynamic_cast<allocator_test_utils *>(allocator_instance.get())->get_blocks_info();
+    
+    ASSERT_EQ(actual_blocks_state.size(), 1);
+    ASSERT_EQ(actual_blocks_state[0], (allocator_test_utils::block_info{ .block_size = 3000, .is_block_occupied = false }));
+}
+
+TEST(positiveTests, test4)
+{
+    std::unique_ptr<smart_mem_resource> allocator(new allocator_boundary_tags(16000, nullptr, nullptr, allocator_with_fit_mode::fit_mode::first_fit));
+    
+    std::vector<std::tuple<void *, size_t, size_t>> blocks;
+    
+    for (size_t alignment = 1; alignment <= 64; alignment <<= 1)
+    {
+        for (size_t size : { 1, 3, 8, 16, 100 })
+        {
+            void *block = allocator->allocate(size, alignment);
+            
+            ASSERT_EQ(reinterpret_cast<std::uintptr_t>(block) % alignment, 0) << "size " << size << ", alignment " << alignment;
+            std::memset(block, 0xAB, size);
+            blocks.emplace_back(block, size, alignment);
+        }
+    }
+    
+    for (auto [block, size, alignment] : blocks)
+    {
+        allocator->deallocate(block, size, alignment);
+    }
+    
+    auto actual_blocks_state = dynamic_cast<allocator_test_utils *>(allocator.get())->get_blocks_info();
+    
+    ASSERT_EQ(actual_blocks_state.size(), 1);
+    ASSERT_EQ(actual_blocks_state[0], (allocator_test_utils::block_info{ .block_size = 16000, .is_block_occupied = false }));
+}
+
+TEST(positiveTests, test5)
+{
+    std::unique_ptr<smart_mem_resource> allocator(new allocator_boundary_tags(1 << 20, nullptr, nullptr, allocator_with_fit_mode::fit_mode::first_fit));
+    
+    // gaps are separated by fences so that they are not coalesced
+    void *first_small = allocator->allocate(64);
+    void *first_fence = allocator->allocate(16);
+    void *medium = allocator->allocate(4096);
+    void *second_fence = allocator->allocate(16);
+    void *second_small = allocator->allocate(64);
+    void *third_fence = allocator->allocate(16);
+    void *large = allocator->allocate(1 << 18);
+    void *fourth_fence = allocator->allocate(16);
+    
+    allocator->deallocate(first_small, 64);
+    allocator->deallocate(second_small, 64);
+    allocator->deallocate(medium, 4096);
+    allocator->deallocate(large, 1 << 18);
+    
+    // both gaps of the request's own bin are taken before any bigger one
+    void *refilled_small = allocator->allocate(64);
+    void *other_refilled_small = allocator->allocate(64);
+    ASSERT_TRUE((refilled_small == first_small && other_refilled_small == second_small)
+        || (refilled_small == second_small && other_refilled_small == first_small));
+    
+    // the next non-empty bin above the request's one is taken, not the tail
+    ASSERT_EQ(allocator->allocate(2048), medium);
+    ASSERT_EQ(allocator->allocate(100000), large);
+    
+    dynamic_cast<allocator_with_fit_mode *>(allocator.get())->set_fit_mode(allocator_with_fit_mode::fit_mode::the_worst_fit);
+    void *tail = allocator->allocate(16);
+    ASSERT_GT(tail, fourth_fence);
+    
+    for (void *block : { first_small, first_fence, medium, second_fence, second_small, third_fence, large, fourth_fence, tail })
+    {
+        allocator->deallocate(block, 1);
+    }
+    
+    auto actual_blocks_state = dynamic_cast<allocator_test_utils *>(allocator.get())->get_blocks_info();
+    
+    ASSERT_EQ(actual_blocks_state.size(), 1);
+    ASSERT_EQ(actual_blocks_state[0], (allocator_test_utils::block_info{ .block_size = 1 << 20, .is_block_occupied = false }));
+}
+
+TEST(positiveTests, test6)
+{
+    std::unique_ptr<smart_mem_resource> allocator(new allocator_boundary_tags(4096, nullptr, nullptr, allocator_with_fit_mode::fit_mode::first_fit));
+    auto *utils = dynamic_cast<allocator_test_utils *>(allocator.get());
+    
+    constexpr size_t block_size = 64 + sizeof(allocator_dbg_helper::block_size_t) + sizeof(allocator_dbg_helper::block_pointer_t) * 3;
+    constexpr size_t tail_size = 4096 - block_size * 5;
+    
+    std::vector<void *> blocks;
+    for (int i = 0; i < 5; ++i)
+    {
+        blocks.push_back(allocator->allocate(64));
+    }
+    
+    allocator->deallocate(blocks[1], 64);
+    allocator->deallocate(blocks[3], 64);
+    
+    ASSERT_EQ(utils->get_blocks_info(), (std::vector<allocator_test_utils::block_info>
+        {
+            { .block_size = block_size, .is_block_occupied = true },
+            { .block_size = block_size, .is_block_occupied = false },
+            { .block_size = block_size, .is_block_occupied = true },
+            { .block_size = block_size, .is_block_occupied = false },
+            { .block_size = block_size, .is_block_occupied = true },
+            { .block_size = tail_size, .is_block_occupied = false }
+        }));
+    
+    // both neighbours are merged into one gap, which has to get into the bin of its new size
+    allocator->deallocate(blocks[2], 64);
+    
+    ASSERT_EQ(utils->get_blocks_info(), (std::vector<allocator_test_utils::block_info>
+        {
+            { .block_size = block_size, .is_block_occupied = true },
+            { .block_size = block_size * 3, .is_block_occupied = false },
+            { .block_size = block_size, .is_block_occupied = true },
+            { .block_size = tail_size, .is_block_occupied = false }
+        }));
+    
+    void *merged = allocator->allocate(block_size * 3 - (block_size - 64));
+    ASSERT_EQ(merged, blocks[1]);
+    allocator->deallocate(merged, 1);
+    
+    allocator->deallocate(blocks[4], 64);
+    
+    ASSERT_EQ(utils->get_blocks_info(), (std::vector<allocator_test_utils::block_info>
+        {
+            { .block_size = block_size, .is_block_occupied = true },
+            { .block_size = 4096 - block_size, .is_block_occupied = false }
+        }));
+    
+    allocator->deallocate(blocks[0], 64);
+    
+    ASSERT_EQ(utils->get_blocks_info(), (std::vector<allocator_test_utils::block_info>
+        {
+            { .block_size = 4096, .is_block_occupied = false }
+        }));
+}
+
+TEST(positiveTests, test7)
+{
+    constexpr size_t blocks_count = 1000;
+    
+    std::unique_ptr<smart_mem_resource> allocator(new allocator_boundary_tags(1 << 20, nullptr, nullptr, allocator_with_fit_mode::fit_mode::first_fit));
+    auto *utils = dynamic_cast<allocator_test_utils *>(allocator.get());
+    
+    std::vector<void *> blocks;
+    for (size_t i = 0; i < blocks_count; ++i)
+    {
+        blocks.push_back(allocator->allocate(64));
+    }
+    
+    for (size_t i = 0; i < blocks_count; i += 2)
+    {
+        allocator->deallocate(blocks[i], 64);
+    }
+    
+    const auto tail_size = utils->get_blocks_info().back().block_size;
+    
+    // every gap of one size class is refilled, the tail stays as is
+    for (size_t i = 0; i < blocks_count; i += 2)
+    {
+        blocks[i] = allocator->allocate(64);
+    }
+    
+    auto actual_blocks_state = utils->get_blocks_info();
+    
+    ASSERT_EQ(actual_blocks_state.size(), blocks_count + 1);
+    ASSERT_EQ(actual_blocks_state.back(), (allocator_test_utils::block_info{ .block_size = tail_size, .is_block_occupied = false }));
+    
+    for (void *block : blocks)
+    {
+        allocator->deallocate(block, 64);
+    }
+    
+    actual_blocks_state = utils->get_blocks_info();
+    
+    ASSERT_EQ(actual_blocks_state.size(), 1);
+    ASSERT_EQ(actual_blocks_state[0], (allocator_test_utils::block_info{ .block_size = 1 << 20, .is_block_occupied = false }));
+}
+
 TEST(falsePositiveTests, test1)
 {
     std::unique_ptr<logger> logger_instance(create_logger(std::vector<std::pair<std::string, logger::severity>>
@@ -113,6 +324,22 @@ TEST(falsePositiveTests, test1)
 
 }
 
+TEST(falsePositiveTests, test2)
+{
+    std::unique_ptr<smart_mem_resource> allocator(new allocator_boundary_tags(3000, nullptr, nullptr, allocator_with_fit_mode::fit_mode::first_fit));
+    
+    // size with the block header or the alignment padding would wrap around
+    for (size_t alignment : { 8, 64 })
+    {
+        ASSERT_THROW(static_cast<void>(allocator->allocate(std::numeric_limits<size_t>::max() - 20, alignment)), std::bad_alloc);
+    }
+    
+    auto actual_blocks_state = dynamic_cast<allocator_test_utils *>(allocator.get())->get_blocks_info();
+    
+    ASSERT_EQ(actual_blocks_state.size(), 1);
+    ASSERT_EQ(actual_blocks_state[0], (allocator_test_utils::block_info{ .block_size = 3000, .is_block_occupied = false }));
+}
+
 TEST(own, test1)
 {
     std::unique_ptr<logger> logger_instance(create_logger(std::vector<std::pair<std::string, logger::severity>>
@@ -8,6 +8,7 @@
 #include <typename_holder.h>
 #include <mutex>
 #include <cmath>
+#include <cstdint>
 
 namespace __detail
 {
@@ -48,20 +49,37 @@ private:
         unsigned char size : 7;
     };
 
+    /** Free blocks are kept in per-order doubly linked lists. Links are indices of minimal blocks
+     *  placed right after the header, so a minimal block is enough to hold them
+     */
+    struct free_block_links
+    {
+        std::uint32_t next;
+        std::uint32_t prev;
+    };
+
+    static constexpr const std::uint32_t null_link = UINT32_MAX;
+
     void *_trusted_memory;
 
-    /**
-     * TODO: You must improve it for alignment support
+    /** Blocks allocated with extended alignment keep the block start right before the aligned payload
      */
 
-    static constexpr const size_t allocator_metadata_size = sizeof(logger*) + sizeof(allocator_dbg_helper*) + sizeof(fit_mode) + sizeof(unsigned char) + sizeof(std::mutex);
+    /** Metadata and occupied block header are padded to max_align_t, so payloads of blocks
+     *  at power of two offsets from the arena start are aligned to it
+     */
+    static constexpr const size_t allocator_metadata_size = align_up(sizeof(logger*) + sizeof(allocator_dbg_helper*) + sizeof(fit_mode) + sizeof(unsigned char) + sizeof(std::mutex));
 
-    static constexpr const size_t occupied_block_metadata_size = sizeof(block_metadata) + sizeof(void*);
+    static constexpr const size_t occupied_block_metadata_size = align_up(sizeof(block_metadata) + sizeof(void*));
 
     static constexpr const size_t free_block_metadata_size = sizeof(block_metadata);
 
     static constexpr const size_t min_k = __detail::nearest_greater_k_of_2(occupied_block_metadata_size);
 
+    static_assert(free_block_metadata_size + sizeof(free_block_links) <= (size_t(1) << min_k));
+
+    static constexpr const size_t orders_count = sizeof(size_t) * 8;
+
 public:
 
     explicit allocator_buddies_system(
@@ -92,6 +110,14 @@ public:
     void do_deallocate_sm(
             void *at) override;
 
+    [[nodiscard]] void *do_allocate_sm(
+            size_t size,
+            size_t alignment) override;
+
+    void do_deallocate_sm(
+            void *at,
+            size_t alignment) override;
+
     bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override;
 
     inline void set_fit_mode(
@@ -104,12 +130,42 @@ private:
 
     inline size_t get_block_size(void* block) const noexcept;
 
+    /** Splits and occupies block of at least size bytes with header included
+     */
+    void* allocate_block(size_t size);
+
+    /** Frees and merges block whose payload starts at at
+     */
+    void deallocate_block(void* block_start, void* at);
+
+    /** Head of the lowest non-empty free list with blocks of at least size bytes
+     */
     void* get_first(size_t size) noexcept;
 
     void* get_best(size_t size) noexcept;
 
+    /** Head of the highest non-empty free list
+     */
     void* get_worst(size_t size) noexcept;
 
+    inline std::byte* get_block(std::uint32_t index) const noexcept;
+
+    inline std::uint32_t get_block_index(void* block) const noexcept;
+
+    inline free_block_links& get_links(void* block) const noexcept;
+
+    /** Position of the bit telling whether a free block of order starts at block, levels are numbered as in a binary heap
+     */
+    inline size_t get_state_bit(void* block, size_t order) const noexcept;
+
+    inline bool is_free(void* block, size_t order) const noexcept;
+
+    /** Adds block to the free list of its order
+     */
+    void push_free_block(void* block) noexcept;
+
+    void remove_free_block(void* block) noexcept;
+
     inline logger *get_logger() const override;
 
     inline std::string get_typename() const override;
@@ -127,6 +183,16 @@ private:
 
     static size_t get_general_size(void* trusted_memory);
 
+    /** Free list heads, non-empty orders mask and block state bitmap stored after the blocks
+     */
+    static size_t get_free_lists_size(size_t space_size);
+
+    static std::uint64_t& get_orders_mask(void* trusted_memory);
+
+    static std::uint32_t* get_free_lists(void* trusted_memory);
+
+    static std::uint8_t* get_states_bitmap(void* trusted_memory);
+
     static std::mutex& get_mutex(void* trusted_memory);
 
     static fit_mode get_fit_mode(void* trusted_memory);
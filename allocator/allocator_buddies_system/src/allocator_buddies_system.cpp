@@ -1,7 +1,11 @@
 #include <not_implemented.h>
 #include <cstddef>
+#include <cstdint>
 #include "../include/allocator_buddies_system.h"
 #include <sstream>
+#include <algorithm>
+#include <bit>
+#include <cstring>
 
 allocator_buddies_system::~allocator_buddies_system()
 {
@@ -13,7 +17,8 @@ allocator_buddies_system::~allocator_buddies_system()
 
     if (parent_allocator == nullptr) parent_allocator = std::pmr::get_default_resource();
 
-    size_t total_size = get_general_size(_trusted_memory) + allocator_metadata_size;
+    size_t total_size = get_general_size(_trusted_memory) + allocator_metadata_size
+            + get_free_lists_size(log_2(get_general_size(_trusted_memory)));
     parent_allocator->deallocate(_trusted_memory, total_size);
 }
 
@@ -39,10 +44,11 @@ allocator_buddies_system::allocator_buddies_system(
     size_t p = allocator_metadata_size;
     size_t l = power_of_two(space_size);
     if (space_size <= log_2(allocator_metadata_size))  throw std::logic_error("space_size too small");
+    if (space_size >= orders_count || space_size - min_k > 32)  throw std::logic_error("space_size too big");
 
     std::pmr::memory_resource* alloc = parent_allocator ? parent_allocator: std::pmr::get_default_resource();
 
-    size_t needed = power_of_two(space_size) + allocator_metadata_size;
+    size_t needed = power_of_two(space_size) + allocator_metadata_size + get_free_lists_size(space_size);
 
     _trusted_memory = alloc->allocate(needed);
 
@@ -69,22 +75,62 @@ allocator_buddies_system::allocator_buddies_system(
     start->occupied = false;
     start->size = __detail::nearest_greater_k_of_2(power_of_two(space_size));
 
-    std::stringstream addr_stream;
-    addr_stream << _trusted_memory;
-    debug_with_guard("allocator created with size " + std::to_string(get_general_size(_trusted_memory)) + " at " + addr_stream.str());
+    get_orders_mask(_trusted_memory) = 0;
+    std::fill_n(get_free_lists(_trusted_memory), orders_count, null_link);
+    std::memset(get_states_bitmap(_trusted_memory), 0, get_free_lists_size(space_size) - sizeof(std::uint64_t) - sizeof(std::uint32_t) * orders_count);
+
+    push_free_block(start);
+
+    debug_with_guard([&]
+    {
+        std::stringstream addr_stream;
+        addr_stream << _trusted_memory;
+        return "allocator created with size " + std::to_string(get_general_size(_trusted_memory)) + " at " + addr_stream.str();
+    });
 }
 
 [[nodiscard]] void *allocator_buddies_system::do_allocate_sm(
         size_t size)
+{
+    if (size > get_general_size(_trusted_memory))
+    {
+        error_with_guard([&] { return "failed to allocate " + std::to_string(size) + " bytes"; });
+        throw std::bad_alloc();
+    }
+
+    return reinterpret_cast<std::byte*>(allocate_block(size + occupied_block_metadata_size)) + occupied_block_metadata_size;
+}
+
+[[nodiscard]] void *allocator_buddies_system::do_allocate_sm(
+        size_t size,
+        size_t alignment)
+{
+    if (size > get_general_size(_trusted_memory) || alignment > get_general_size(_trusted_memory))
+    {
+        error_with_guard([&] { return "failed to allocate " + std::to_string(size) + " bytes aligned to " + std::to_string(alignment); });
+        throw std::bad_alloc();
+    }
+
+    auto block = reinterpret_cast<std::byte*>(allocate_block(size + occupied_block_metadata_size + sizeof(void*) + alignment - 1));
+
+    auto payload = reinterpret_cast<std::uintptr_t>(block) + occupied_block_metadata_size + sizeof(void*);
+    payload = (payload + alignment - 1) & ~(alignment - 1);
+
+    *reinterpret_cast<void**>(payload - sizeof(void*)) = block;
+    return reinterpret_cast<void*>(payload);
+}
+
+void* allocator_buddies_system::allocate_block(size_t size)
 {
     std::lock_guard<std::mutex> lock(get_mutex(_trusted_memory));
 
-    size_t needed = power_of_two(__detail::nearest_greater_k_of_2(size + occupied_block_metadata_size));
+    size_t needed = power_of_two(__detail::nearest_greater_k_of_2(size));
 
     void* free_block_ptr = nullptr;
     switch (get_fit_mode(_trusted_memory))
     {
         case allocator_with_fit_mode::fit_mode::first_fit:
+        case allocator_with_fit_mode::fit_mode::next_fit:
             free_block_ptr = get_first(needed);
             break;
         case allocator_with_fit_mode::fit_mode::the_best_fit:
@@ -97,16 +143,19 @@ allocator_buddies_system::allocator_buddies_system(
 
     if (free_block_ptr == nullptr)
     {
-        debug_with_guard("failed to allocate " + std::to_string(needed) + " bytes");
+        debug_with_guard([&] { return "failed to allocate " + std::to_string(needed) + " bytes"; });
         throw std::bad_alloc();
     }
 
+    remove_free_block(free_block_ptr);
+
     while (get_block_size(free_block_ptr) >= needed * 2)
     {
         --(reinterpret_cast<block_metadata*>(free_block_ptr)->size);
         auto cur_buddy = get_buddy(free_block_ptr);
         reinterpret_cast<block_metadata*>(cur_buddy)->size = reinterpret_cast<block_metadata*>(free_block_ptr)->size;
         reinterpret_cast<block_metadata*>(cur_buddy)->occupied = false;
+        push_free_block(cur_buddy);
     }
 
     auto free_metadata = reinterpret_cast<block_metadata*>(free_block_ptr);
@@ -115,21 +164,32 @@ allocator_buddies_system::allocator_buddies_system(
     auto parent_ptr = reinterpret_cast<void**>(free_metadata + 1);
     *parent_ptr = _trusted_memory;
 
-    std::stringstream addr_stream1;
-    addr_stream1 << free_block_ptr;
+    debug_with_guard([&]
+    {
+        std::stringstream addr_stream1;
+        addr_stream1 << free_block_ptr;
 
-    std::stringstream addr_stream2;
-    addr_stream2 << (reinterpret_cast<std::byte*>(free_block_ptr) - (reinterpret_cast<std::byte*>(_trusted_memory) + allocator_metadata_size));
+        std::stringstream addr_stream2;
+        addr_stream2 << (reinterpret_cast<std::byte*>(free_block_ptr) - (reinterpret_cast<std::byte*>(_trusted_memory) + allocator_metadata_size));
 
-    debug_with_guard("allocator allocated " + std::to_string(needed) + " bytes at " + addr_stream1.str() + " (" + addr_stream2.str() + ")");
-    return reinterpret_cast<std::byte*>(free_block_ptr) + occupied_block_metadata_size;
+        return "allocator allocated " + std::to_string(needed) + " bytes at " + addr_stream1.str() + " (" + addr_stream2.str() + ")";
+    });
+    return free_block_ptr;
 }
 
 void allocator_buddies_system::do_deallocate_sm(void *at)
+{
+    deallocate_block(reinterpret_cast<std::byte*>(at) - occupied_block_metadata_size, at);
+}
+
+void allocator_buddies_system::do_deallocate_sm(void *at, size_t)
+{
+    deallocate_block(*(reinterpret_cast<void**>(at) - 1), at);
+}
+
+void allocator_buddies_system::deallocate_block(void* block_start, void* at)
 {
     std::lock_guard lock(get_mutex(_trusted_memory));
-    std::cout << reinterpret_cast<block_metadata*>(at)->occupied << std::endl;
-    void* block_start = reinterpret_cast<std::byte*>(at) - occupied_block_metadata_size;
 
     if (*reinterpret_cast<void**>(reinterpret_cast<std::byte*>(block_start) + sizeof(block_metadata)) != _trusted_memory)
     {
@@ -137,16 +197,17 @@ void allocator_buddies_system::do_deallocate_sm(void *at)
         throw std::logic_error("get wrong deallocation object");
     }
 
-    size_t block_size = get_block_size(block_start) - occupied_block_metadata_size;
+    size_t block_size = get_block_size(block_start) - (reinterpret_cast<std::byte*>(at) - reinterpret_cast<std::byte*>(block_start));
 
-    debug_with_guard(get_dump((char*)at, block_size));
+    debug_with_guard([&] { return get_dump((char*)at, block_size); });
 
     reinterpret_cast<block_metadata*>(block_start)->occupied = false;
 
     void* buddy = get_buddy(block_start);
 
-    while(get_block_size(block_start) < get_general_size(_trusted_memory) && get_block_size(block_start) == get_block_size(buddy) && !reinterpret_cast<block_metadata*>(buddy)->occupied)
+    while(get_block_size(block_start) < get_general_size(_trusted_memory) && is_free(buddy, reinterpret_cast<block_metadata*>(block_start)->size))
     {
+        remove_free_block(buddy);
         void* interested_ptr = block_start < buddy ? block_start : buddy;
 
         auto metadata = reinterpret_cast<block_metadata*>(interested_ptr);
@@ -155,7 +216,9 @@ void allocator_buddies_system::do_deallocate_sm(void *at)
         block_start = interested_ptr;
         buddy = get_buddy(block_start);
     }
-    debug_with_guard("deallocated " + std::to_string(block_size) + " bytes and merged to" + std::to_string(get_block_size(block_start)));
+
+    push_free_block(block_start);
+    debug_with_guard([&] { return "deallocated " + std::to_string(block_size) + " bytes and merged to" + std::to_string(get_block_size(block_start)); });
 
 }
 
@@ -252,47 +315,88 @@ allocator_buddies_system::buddy_iterator::buddy_iterator(): _block(nullptr) {}
 
 void *allocator_buddies_system::get_first(size_t size) noexcept
 {
-    for(auto it = begin(), sent = end(); it != sent; ++it)
-    {
-        if (!it.occupied() && it.size() >= size)
-        {
-            return *it;
-        }
-    }
-    return nullptr;
+    auto orders = get_orders_mask(_trusted_memory) & (~std::uint64_t(0) << log_2(size));
+    return orders == 0 ? nullptr : get_block(get_free_lists(_trusted_memory)[std::countr_zero(orders)]);
 }
 
 void *allocator_buddies_system::get_best(size_t size) noexcept
 {
-    buddy_iterator res;
+    return get_first(size);
+}
 
-    for(auto it = begin(), sent = end(); it != sent; ++it)
-    {
-        if (!it.occupied() && it.size() >= size && (it.size() < res.size() || *res == nullptr))
-        {
-            res = it;
-        }
-    }
+void *allocator_buddies_system::get_worst(size_t size) noexcept
+{
+    auto orders = get_orders_mask(_trusted_memory);
+    size_t highest = std::bit_width(orders) - 1;
+    if (orders == 0 || highest < log_2(size)) return nullptr;
 
-    return *res;
+    return get_block(get_free_lists(_trusted_memory)[highest]);
 }
 
-void *allocator_buddies_system::get_worst(size_t size) noexcept
+std::byte *allocator_buddies_system::get_block(std::uint32_t index) const noexcept
 {
-    buddy_iterator res;
-    size_t res_size = 0;
-    for(auto it = begin(), sent = end(); it != sent; ++it)
-    {
-        if (!it.occupied() && it.size() >= size && (it.size() > res_size || *res == nullptr))
-        {
-            res_size = it.size();
-            res = it;
-        }
-    }
+    return index == null_link
+           ? nullptr
+           : reinterpret_cast<std::byte*>(_trusted_memory) + allocator_metadata_size + (size_t(index) << min_k);
+}
+
+std::uint32_t allocator_buddies_system::get_block_index(void *block) const noexcept
+{
+    return block == nullptr
+           ? null_link
+           : (reinterpret_cast<std::byte*>(block) - (reinterpret_cast<std::byte*>(_trusted_memory) + allocator_metadata_size)) >> min_k;
+}
+
+allocator_buddies_system::free_block_links &allocator_buddies_system::get_links(void *block) const noexcept
+{
+    return *reinterpret_cast<free_block_links*>(reinterpret_cast<std::byte*>(block) + free_block_metadata_size);
+}
+
+size_t allocator_buddies_system::get_state_bit(void *block, size_t order) const noexcept
+{
+    size_t level = log_2(get_general_size(_trusted_memory)) - order;
+    size_t offset = reinterpret_cast<std::byte*>(block) - (reinterpret_cast<std::byte*>(_trusted_memory) + allocator_metadata_size);
+    return power_of_two(level) + (offset >> order);
+}
+
+bool allocator_buddies_system::is_free(void *block, size_t order) const noexcept
+{
+    size_t bit = get_state_bit(block, order);
+    return (get_states_bitmap(_trusted_memory)[bit / 8] >> (bit % 8)) & 1;
+}
+
+void allocator_buddies_system::push_free_block(void *block) noexcept
+{
+    size_t order = reinterpret_cast<block_metadata*>(block)->size;
+    auto& head = get_free_lists(_trusted_memory)[order];
+    auto& links = get_links(block);
+
+    links.prev = null_link;
+    links.next = head;
+    if (head != null_link) get_links(get_block(head)).prev = get_block_index(block);
+    head = get_block_index(block);
 
-    return *res;
+    get_orders_mask(_trusted_memory) |= std::uint64_t(1) << order;
+
+    size_t bit = get_state_bit(block, order);
+    get_states_bitmap(_trusted_memory)[bit / 8] |= std::uint8_t(1) << (bit % 8);
 }
 
+void allocator_buddies_system::remove_free_block(void *block) noexcept
+{
+    size_t order = reinterpret_cast<block_metadata*>(block)->size;
+    auto& head = get_free_lists(_trusted_memory)[order];
+    auto& links = get_links(block);
+
+    if (links.prev != null_link) get_links(get_block(links.prev)).next = links.next;
+    else head = links.next;
+    if (links.next != null_link) get_links(get_block(links.next)).prev = links.prev;
+
+    if (head == null_link) get_orders_mask(_trusted_memory) &= ~(std::uint64_t(1) << order);
+
+    size_t bit = get_state_bit(block, order);
+    get_states_bitmap(_trusted_memory)[bit / 8] &= ~(std::uint8_t(1) << (bit % 8));
+}
 
 size_t allocator_buddies_system::get_block_size(void* block) const noexcept {
     return power_of_two(reinterpret_cast<block_metadata*>(block)->size);
@@ -307,7 +411,7 @@ void *allocator_buddies_system::get_buddy(void *cur_block) {
 
 size_t allocator_buddies_system::power_of_two(size_t size)
 {
-    size_t res = 1 << size;
+    size_t res = size_t(1) << size;
     return res;
 }
 
@@ -329,8 +433,29 @@ inline logger* allocator_buddies_system::get_logger() const
 size_t allocator_buddies_system::get_general_size(void *trusted_memory)
 {
     auto ptr = reinterpret_cast<std::byte*>(trusted_memory) + sizeof(logger*) + sizeof(allocator_dbg_helper*) + sizeof(fit_mode);
-    return power_of_two(*reinterpret_cast<size_t*>(ptr));
+    return power_of_two(*reinterpret_cast<unsigned char*>(ptr));
+
+}
+
+size_t allocator_buddies_system::get_free_lists_size(size_t space_size)
+{
+    return sizeof(std::uint64_t) + sizeof(std::uint32_t) * orders_count + std::max<size_t>(1, power_of_two(space_size - min_k + 1) / 8);
+}
+
+std::uint64_t& allocator_buddies_system::get_orders_mask(void *trusted_memory)
+{
+    auto ptr = reinterpret_cast<std::byte*>(trusted_memory) + allocator_metadata_size + get_general_size(trusted_memory);
+    return *reinterpret_cast<std::uint64_t*>(ptr);
+}
 
+std::uint32_t* allocator_buddies_system::get_free_lists(void *trusted_memory)
+{
+    return reinterpret_cast<std::uint32_t*>(&get_orders_mask(trusted_memory) + 1);
+}
+
+std::uint8_t* allocator_buddies_system::get_states_bitmap(void *trusted_memory)
+{
+    return reinterpret_cast<std::uint8_t*>(get_free_lists(trusted_memory) + orders_count);
 }
 
 allocator_dbg_helper* allocator_buddies_system::get_parent(void *trusted_memory)
@@ -1,5 +1,11 @@
 #include <gtest/gtest.h>
+#include <algorithm>
 #include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <tuple>
+#include <vector>
 #include <allocator_dbg_helper.h>
 #include <allocator_buddies_system.h>
 #include <client_logger_builder.h>
@@ -199,11 +205,173 @@ TEST(positiveTests, test53)
     }
 }
 
+TEST(positiveTests, test4)
+{
+    std::unique_ptr<smart_mem_resource> allocator(new allocator_buddies_system(12, nullptr, nullptr, allocator_with_fit_mode::fit_mode::first_fit));
+    
+    auto first_block = reinterpret_cast<char *>(allocator->allocate(sizeof(char) * 40));
+    auto second_block = reinterpret_cast<char *>(allocator->allocate(sizeof(char) * 100, 128));
+    
+    ASSERT_EQ(reinterpret_cast<std::uintptr_t>(second_block) % 128, 0);
+    
+    allocator->deallocate(second_block, 1, 128);
+    allocator->deallocate(first_block, 1);
+    
+    auto actual_blocks_state = dynamic_cast<allocator_test_utils *>(allocator.get())->get_blocks_info();
+    
+    ASSERT_EQ(actual_blocks_state.size(), 1);
+    ASSERT_EQ(actual_blocks_state[0], (allocator_test_utils::block_info{ .block_size = 4096, .is_block_occupied = false }));
+}
+
+TEST(positiveTests, test5)
+{
+    std::unique_ptr<smart_mem_resource> allocator(new allocator_buddies_system(15, nullptr, nullptr, allocator_with_fit_mode::fit_mode::first_fit));
+    
+    std::vector<std::tuple<void *, size_t, size_t>> blocks;
+    
+    for (size_t alignment = 1; alignment <= 64; alignment <<= 1)
+    {
+        for (size_t size : { 1, 3, 8, 16, 100 })
+        {
+            void *block = allocator->allocate(size, alignment);
+            
+            ASSERT_EQ(reinterpret_cast<std::uintptr_t>(block) % alignment, 0) << "size " << size << ", alignment " << alignment;
+            std::memset(block, 0xAB, size);
+            blocks.emplace_back(block, size, alignment);
+        }
+    }
+    
+    for (auto [block, size, alignment] : blocks)
+    {
+        allocator->deallocate(block, size, alignment);
+    }
+    
+    auto actual_blocks_state = dynamic_cast<allocator_test_utils *>(allocator.get())->get_blocks_info();
+    
+    ASSERT_EQ(actual_blocks_state.size(), 1);
+    ASSERT_EQ(actual_blocks_state[0], (allocator_test_utils::block_info{ .block_size = 1 << 15, .is_block_occupied = false }));
+}
+
+TEST(positiveTests, test6)
+{
+    std::unique_ptr<smart_mem_resource> allocator(new allocator_buddies_system(10, nullptr, nullptr, allocator_with_fit_mode::fit_mode::first_fit));
+    auto *utils = dynamic_cast<allocator_test_utils *>(allocator.get());
+    
+    // 48 bytes with the occupied block header take a 64 bytes block, 16 of them fill the whole space
+    std::vector<void *> blocks;
+    for (int i = 0; i < 16; ++i)
+    {
+        blocks.push_back(allocator->allocate(48));
+    }
+    
+    auto actual_blocks_state = utils->get_blocks_info();
+    ASSERT_EQ(actual_blocks_state.size(), 16);
+    for (auto &block : actual_blocks_state)
+    {
+        ASSERT_EQ(block, (allocator_test_utils::block_info{ .block_size = 64, .is_block_occupied = true }));
+    }
+    
+    // no block has its buddy free, so nothing is coalesced
+    for (int i = 15; i > 0; i -= 2)
+    {
+        allocator->deallocate(blocks[i], 48);
+    }
+    
+    actual_blocks_state = utils->get_blocks_info();
+    ASSERT_EQ(actual_blocks_state.size(), 16);
+    for (int i = 0; i < 16; ++i)
+    {
+        ASSERT_EQ(actual_blocks_state[i], (allocator_test_utils::block_info{ .block_size = 64, .is_block_occupied = i % 2 == 0 }));
+    }
+    
+    allocator->deallocate(blocks[8], 48);
+    allocator->deallocate(blocks[0], 48);
+    allocator->deallocate(blocks[14], 48);
+    allocator->deallocate(blocks[4], 48);
+    
+    ASSERT_EQ(utils->get_blocks_info(), (std::vector<allocator_test_utils::block_info>
+        {
+            { .block_size = 128, .is_block_occupied = false },
+            { .block_size = 64, .is_block_occupied = true },
+            { .block_size = 64, .is_block_occupied = false },
+            { .block_size = 128, .is_block_occupied = false },
+            { .block_size = 64, .is_block_occupied = true },
+            { .block_size = 64, .is_block_occupied = false },
+            { .block_size = 128, .is_block_occupied = false },
+            { .block_size = 64, .is_block_occupied = true },
+            { .block_size = 64, .is_block_occupied = false },
+            { .block_size = 64, .is_block_occupied = true },
+            { .block_size = 64, .is_block_occupied = false },
+            { .block_size = 128, .is_block_occupied = false }
+        }));
+    
+    allocator->deallocate(blocks[10], 48);
+    allocator->deallocate(blocks[2], 48);
+    allocator->deallocate(blocks[12], 48);
+    allocator->deallocate(blocks[6], 48);
+    
+    ASSERT_EQ(utils->get_blocks_info(), (std::vector<allocator_test_utils::block_info>
+        {
+            { .block_size = 1024, .is_block_occupied = false }
+        }));
+    
+    // the worst fit splits the biggest free block, while the first fit takes a fitting one without splitting
+    dynamic_cast<allocator_with_fit_mode *>(allocator.get())->set_fit_mode(allocator_with_fit_mode::fit_mode::the_worst_fit);
+    
+    void *small = allocator->allocate(48);
+    void *worst = allocator->allocate(200);
+    
+    ASSERT_EQ(utils->get_blocks_info(), (std::vector<allocator_test_utils::block_info>
+        {
+            { .block_size = 64, .is_block_occupied = true },
+            { .block_size = 64, .is_block_occupied = false },
+            { .block_size = 128, .is_block_occupied = false },
+            { .block_size = 256, .is_block_occupied = false },
+            { .block_size = 256, .is_block_occupied = true },
+            { .block_size = 256, .is_block_occupied = false }
+        }));
+    
+    dynamic_cast<allocator_with_fit_mode *>(allocator.get())->set_fit_mode(allocator_with_fit_mode::fit_mode::first_fit);
+    
+    void *first = allocator->allocate(200);
+    
+    // one of the free 256 bytes blocks is taken as is, nothing is split
+    actual_blocks_state = utils->get_blocks_info();
+    ASSERT_EQ(actual_blocks_state.size(), 6);
+    ASSERT_EQ(std::count(actual_blocks_state.begin(), actual_blocks_state.end(),
+        allocator_test_utils::block_info{ .block_size = 256, .is_block_occupied = true }), 2);
+    
+    allocator->deallocate(worst, 200);
+    allocator->deallocate(small, 48);
+    allocator->deallocate(first, 200);
+    
+    ASSERT_EQ(utils->get_blocks_info(), (std::vector<allocator_test_utils::block_info>
+        {
+            { .block_size = 1024, .is_block_occupied = false }
+        }));
+}
+
 TEST(falsePositiveTests, test1)
 {
     ASSERT_THROW(new allocator_buddies_system(static_cast<int>(std::floor(std::log2(sizeof(allocator_dbg_helper::block_pointer_t) * 2 + 1))) - 1), std::logic_error);
 }
 
+TEST(falsePositiveTests, test2)
+{
+    std::unique_ptr<smart_mem_resource> allocator(new allocator_buddies_system(12, nullptr, nullptr, allocator_with_fit_mode::fit_mode::first_fit));
+    
+    // size with the block header or the alignment padding would wrap around
+    for (size_t alignment : { 8, 64 })
+    {
+        ASSERT_THROW(static_cast<void>(allocator->allocate(std::numeric_limits<size_t>::max() - 20, alignment)), std::bad_alloc);
+    }
+    
+    auto actual_blocks_state = dynamic_cast<allocator_test_utils *>(allocator.get())->get_blocks_info();
+    
+    ASSERT_EQ(actual_blocks_state.size(), 1);
+    ASSERT_EQ(actual_blocks_state[0], (allocator_test_utils::block_info{ .block_size = 4096, .is_block_occupied = false }));
+}
+
 int main(
         int argc,
         char *argv[])
@@ -1,6 +1,22 @@
 #include "../include/allocator_global_heap.h"
+#include <new>
 #include <sstream>
 
+namespace
+{
+    std::string address_to_string(std::uintptr_t address)
+    {
+        std::ostringstream oss;
+        oss << "0x" << std::hex << address;
+        return oss.str();
+    }
+
+    std::string address_to_string(const void* ptr)
+    {
+        return address_to_string(reinterpret_cast<std::uintptr_t>(ptr));
+    }
+}
+
 allocator_global_heap::allocator_global_heap(logger *logger)
         : _logger(logger)
 {
@@ -52,23 +68,21 @@ allocator_global_heap &allocator_global_heap::operator=(allocator_global_heap &&
 
 void* allocator_global_heap::do_allocate_sm(const size_t size)
 {
-    debug_with_guard("Starting allocation of size " + std::to_string(size));
+    debug_with_guard([&] { return "Starting allocation of size " + std::to_string(size); });
     try
     {
         void* ptr = ::operator new(size);
-        std::ostringstream oss;
-        oss << "0x" << std::hex << reinterpret_cast<std::uintptr_t>(ptr);
-        debug_with_guard("Successfully allocated memory at " + oss.str() + " of size " + std::to_string(size));
+        debug_with_guard([&] { return "Successfully allocated memory at " + address_to_string(ptr) + " of size " + std::to_string(size); });
         return ptr;
     }
     catch (const std::bad_alloc& e)
     {
-        error_with_guard("Failed to allocate memory of size " + std::to_string(size) + ": " + std::string(e.what()));
+        error_with_guard([&] { return "Failed to allocate memory of size " + std::to_string(size) + ": " + std::string(e.what()); });
         throw;
     }
     catch (const std::exception& e)
     {
-        error_with_guard("Unexpected exception during memory allocation: " + std::string(e.what()));
+        error_with_guard([&] { return "Unexpected exception during memory allocation: " + std::string(e.what()); });
         throw;
     }
 }
@@ -81,11 +95,42 @@ void allocator_global_heap::do_deallocate_sm(void* at)
         return;
     }
 
-    std::ostringstream oss;
-    oss << "0x" << std::hex << reinterpret_cast<std::uintptr_t>(at);
-    debug_with_guard("Starting deallocatn of memory at " + oss.str());
+    debug_with_guard([&] { return "Starting deallocatn of memory at " + address_to_string(at); });
+    // the address is only printed, it is taken before the memory is released
+    const auto address = reinterpret_cast<std::uintptr_t>(at);
     ::operator delete(at);
-    debug_with_guard("Successfully deallocated memory at " + oss.str());
+    debug_with_guard([&] { return "Successfully deallocated memory at " + address_to_string(address); });
+}
+
+void* allocator_global_heap::do_allocate_sm(const size_t size, const size_t alignment)
+{
+    debug_with_guard([&] { return "Starting allocation of size " + std::to_string(size) + " aligned to " + std::to_string(alignment); });
+    try
+    {
+        void* ptr = ::operator new(size, std::align_val_t(alignment));
+        debug_with_guard([&] { return "Successfully allocated memory at " + address_to_string(ptr) + " of size " + std::to_string(size); });
+        return ptr;
+    }
+    catch (const std::bad_alloc& e)
+    {
+        error_with_guard([&] { return "Failed to allocate memory of size " + std::to_string(size) + ": " + std::string(e.what()); });
+        throw;
+    }
+}
+
+void allocator_global_heap::do_deallocate_sm(void* at, const size_t alignment)
+{
+    if (at == nullptr)
+    {
+        debug_with_guard("Attempted to deallocate NULL pointer - ignoring");
+        return;
+    }
+
+    debug_with_guard([&] { return "Starting deallocation of memory at " + address_to_string(at) + " aligned to " + std::to_string(alignment); });
+    // the address is only printed, it is taken before the memory is released
+    const auto address = reinterpret_cast<std::uintptr_t>(at);
+    ::operator delete(at, std::align_val_t(alignment));
+    debug_with_guard([&] { return "Successfully deallocated memory at " + address_to_string(address); });
 }
 
 bool allocator_global_heap::do_is_equal(const std::pmr::memory_resource& other) const noexcept
@@ -1,4 +1,8 @@
 #include <gtest/gtest.h>
+#include <cstdint>
+#include <cstring>
+#include <tuple>
+#include <vector>
 #include <iostream>
 #include <allocator_global_heap.h>
 #include <client_logger_builder.h>
@@ -77,6 +81,30 @@ TEST(allocatorGlobalHeapTests, test4)
     allocator_instance->deallocate(second_block, 1);
 }
 
+TEST(allocatorGlobalHeapTests, test5)
+{
+    std::unique_ptr<smart_mem_resource> allocator(new allocator_global_heap());
+    
+    std::vector<std::tuple<void *, size_t, size_t>> blocks;
+    
+    for (size_t alignment = 1; alignment <= 64; alignment <<= 1)
+    {
+        for (size_t size : { 1, 3, 8, 16, 100 })
+        {
+            void *block = allocator->allocate(size, alignment);
+            
+            ASSERT_EQ(reinterpret_cast<std::uintptr_t>(block) % alignment, 0) << "size " << size << ", alignment " << alignment;
+            std::memset(block, 0xAB, size);
+            blocks.emplace_back(block, size, alignment);
+        }
+    }
+    
+    for (auto [block, size, alignment] : blocks)
+    {
+        allocator->deallocate(block, size, alignment);
+    }
+}
+
 int main(
     int argc,
     char *argv[])
@@ -29,8 +29,13 @@ private:
 
     void *_trusted_memory;
 
-    static constexpr const size_t allocator_metadata_size = sizeof(logger*) + sizeof(allocator_dbg_helper*) + sizeof(fit_mode) + sizeof(size_t) + sizeof(std::mutex) + sizeof(void*);
-    static constexpr const size_t occupied_block_metadata_size = sizeof(block_data) + 3 * sizeof(void*);
+    /** Every block starts with block_data followed by pointers to the previous and the next block by address.
+     *  Occupied blocks keep trusted memory pointer then, free blocks keep parent, left and right tree nodes.
+     *  Free blocks are ordered in the tree by (size, address), size of a block includes its header.
+     *  Metadata, occupied block header and block sizes are padded to max_align_t, so payloads are aligned to it
+     */
+    static constexpr const size_t allocator_metadata_size = align_up(sizeof(logger*) + sizeof(allocator_dbg_helper*) + sizeof(fit_mode) + sizeof(size_t) + sizeof(std::mutex) + sizeof(void*));
+    static constexpr const size_t occupied_block_metadata_size = align_up(sizeof(block_data) + 3 * sizeof(void*));
     static constexpr const size_t free_block_metadata_size = sizeof(block_data) + 5 * sizeof(void*);
 
 public:
@@ -38,10 +43,10 @@ public:
     ~allocator_red_black_tree() override;
     
     allocator_red_black_tree(
-        allocator_red_black_tree const &other);
+        allocator_red_black_tree const &other) = delete;
     
     allocator_red_black_tree &operator=(
-        allocator_red_black_tree const &other);
+        allocator_red_black_tree const &other) = delete;
     
     allocator_red_black_tree(
         allocator_red_black_tree &&other) noexcept;
@@ -65,6 +70,16 @@ public:
     void do_deallocate_sm(
         void *at) override;
 
+    /** Block is split so that the payload is aligned, padding before its header stays a free block
+     */
+    [[nodiscard]] void *do_allocate_sm(
+        size_t size,
+        size_t alignment) override;
+
+    void do_deallocate_sm(
+        void *at,
+        size_t alignment) override;
+
     bool do_is_equal(const std::pmr::memory_resource&) const noexcept override;
 
     std::vector<allocator_test_utils::block_info> get_blocks_info() const override;
@@ -79,6 +94,72 @@ private:
 
     inline std::string get_typename() const noexcept override;
 
+    static std::pmr::memory_resource*& get_parent_resource(void* trusted_memory) noexcept;
+
+    static fit_mode& get_fit_mode(void* trusted_memory) noexcept;
+
+    static size_t& get_space_size(void* trusted_memory) noexcept;
+
+    static std::mutex& get_mutex(void* trusted_memory) noexcept;
+
+    static void*& get_root(void* trusted_memory) noexcept;
+
+    static void* get_first_block(void* trusted_memory) noexcept;
+
+    static block_data& get_block_data(void* block) noexcept;
+
+    static void*& get_prev_block(void* block) noexcept;
+
+    static void*& get_next_block(void* block) noexcept;
+
+    static void*& get_block_trusted(void* block) noexcept;
+
+    static void*& get_parent_node(void* block) noexcept;
+
+    static void*& get_left_node(void* block) noexcept;
+
+    static void*& get_right_node(void* block) noexcept;
+
+    static size_t get_block_size(void* block, void* trusted_memory) noexcept;
+
+    static bool is_red(void* node) noexcept;
+
+    /** Order of free blocks in the tree
+     */
+    bool is_less(void* left, void* right) const noexcept;
+
+    /** First node met on the way down that fits
+     */
+    void* get_first_fit(size_t size) const noexcept;
+
+    /** Smallest block that fits, the leftmost one among equal sizes
+     */
+    void* get_best_fit(size_t size) const noexcept;
+
+    void* get_worst_fit(size_t size) const noexcept;
+
+    /** Free block of at least size bytes chosen by the fit mode, nullptr if there is none
+     */
+    void* get_fit(size_t size) const noexcept;
+
+    /** Occupies free block taken out of the tree, rest of it after needed bytes is split off if it can be free
+     */
+    void* occupy_block(void* block, size_t needed) noexcept;
+
+    void rotate_left(void* node) noexcept;
+
+    void rotate_right(void* node) noexcept;
+
+    void transplant(void* from, void* to) noexcept;
+
+    void insert_free_block(void* block) noexcept;
+
+    void remove_free_block(void* block) noexcept;
+
+    void fix_after_insert(void* node) noexcept;
+
+    void fix_after_remove(void* node, void* parent) noexcept;
+
     class rb_iterator
     {
         void* _block_ptr;
@@ -1,22 +1,37 @@
-#include <not_implemented.h>
-
 #include "../include/allocator_red_black_tree.h"
+#include <algorithm>
+#include <cstdint>
+#include <format>
+#include <memory>
 
 allocator_red_black_tree::~allocator_red_black_tree()
 {
-    throw not_implemented("allocator_red_black_tree::~allocator_red_black_tree()", "your code should be here...");
+    if (_trusted_memory == nullptr)
+    {
+        return;
+    }
+
+    debug_with_guard("[*] allocator destructor started");
+
+    get_mutex(_trusted_memory).~mutex();
+    get_parent_resource(_trusted_memory)->deallocate(_trusted_memory, allocator_metadata_size + get_space_size(_trusted_memory));
 }
 
 allocator_red_black_tree::allocator_red_black_tree(
     allocator_red_black_tree &&other) noexcept
+        : _trusted_memory(std::exchange(other._trusted_memory, nullptr))
 {
-    throw not_implemented("allocator_red_black_tree::allocator_red_black_tree(allocator_red_black_tree &&) noexcept", "your code should be here...");
 }
 
 allocator_red_black_tree &allocator_red_black_tree::operator=(
     allocator_red_black_tree &&other) noexcept
 {
-    throw not_implemented("allocator_red_black_tree &allocator_red_black_tree::operator=(allocator_red_black_tree &&) noexcept", "your code should be here...");
+    if (this != &other)
+    {
+        std::swap(_trusted_memory, other._trusted_memory);
+    }
+
+    return *this;
 }
 
 allocator_red_black_tree::allocator_red_black_tree(
@@ -25,116 +40,725 @@ allocator_red_black_tree::allocator_red_black_tree(
         logger *logger,
         allocator_with_fit_mode::fit_mode allocate_fit_mode)
 {
-    throw not_implemented("allocator_red_black_tree::allocator_red_black_tree(size_t ,std::pmr::memory_resource *,logger *,allocator_with_fit_mode::fit_mode)", "your code should be here...");
+    if (space_size < free_block_metadata_size)
+    {
+        throw std::logic_error("`space_size` is not enough to fit a single block");
+    }
+
+    const auto allocator = parent_allocator != nullptr ? parent_allocator : std::pmr::get_default_resource();
+
+    _trusted_memory = allocator->allocate(allocator_metadata_size + space_size);
+
+    *reinterpret_cast<class logger**>(_trusted_memory) = logger;
+    get_parent_resource(_trusted_memory) = allocator;
+    get_fit_mode(_trusted_memory) = allocate_fit_mode;
+    get_space_size(_trusted_memory) = space_size;
+    std::construct_at(&get_mutex(_trusted_memory));
+    get_root(_trusted_memory) = nullptr;
+
+    void* block = get_first_block(_trusted_memory);
+    get_block_data(block).occupied = false;
+    get_prev_block(block) = nullptr;
+    get_next_block(block) = nullptr;
+
+    insert_free_block(block);
+
+    debug_with_guard([&] { return std::format("[+] allocator created with {} bytes", space_size); });
 }
 
-allocator_red_black_tree::allocator_red_black_tree(const allocator_red_black_tree &other)
+bool allocator_red_black_tree::do_is_equal(const std::pmr::memory_resource &other) const noexcept
 {
-    throw not_implemented("allocator_red_black_tree::allocator_red_black_tree(const allocator_red_black_tree &other)", "your code should be here...");
+    return this == &other;
 }
 
-allocator_red_black_tree &allocator_red_black_tree::operator=(const allocator_red_black_tree &other)
+[[nodiscard]] void *allocator_red_black_tree::do_allocate_sm(
+    size_t size)
 {
-    throw not_implemented("allocator_red_black_tree &allocator_red_black_tree::operator=(const allocator_red_black_tree &other)", "your code should be here...");
+    if (size > get_space_size(_trusted_memory))
+    {
+        error_with_guard([&] { return std::format("[!] out of memory: requested {} bytes", size); });
+        throw std::bad_alloc();
+    }
+
+    const size_t needed = align_up(std::max(size + occupied_block_metadata_size, free_block_metadata_size));
+    debug_with_guard([&] { return std::format("[*] allocating {} bytes", needed); });
+
+    std::lock_guard lock(get_mutex(_trusted_memory));
+
+    void* block = get_fit(needed);
+
+    if (block == nullptr)
+    {
+        error_with_guard([&] { return std::format("[!] out of memory: requested {} bytes", needed); });
+        throw std::bad_alloc();
+    }
+
+    remove_free_block(block);
+
+    return occupy_block(block, needed);
 }
 
-bool allocator_red_black_tree::do_is_equal(const std::pmr::memory_resource &other) const noexcept
+[[nodiscard]] void *allocator_red_black_tree::do_allocate_sm(
+    size_t size,
+    size_t alignment)
 {
-    throw not_implemented("bool allocator_red_black_tree::do_is_equal(const std::pmr::memory_resource &other) const noexcept", "your code should be here...");
+    if (size > get_space_size(_trusted_memory) || alignment > get_space_size(_trusted_memory))
+    {
+        error_with_guard([&] { return std::format("[!] out of memory: requested {} bytes aligned to {}", size, alignment); });
+        throw std::bad_alloc();
+    }
+
+    const size_t needed = align_up(std::max(size + occupied_block_metadata_size, free_block_metadata_size));
+    const size_t min_padding = align_up(free_block_metadata_size);
+    debug_with_guard([&] { return std::format("[*] allocating {} bytes aligned to {}", needed, alignment); });
+
+    std::lock_guard lock(get_mutex(_trusted_memory));
+
+    // padding before the header is either empty or a free block, so it takes less than alignment + min_padding
+    void* block = get_fit(needed + alignment + min_padding);
+
+    if (block == nullptr)
+    {
+        error_with_guard([&] { return std::format("[!] out of memory: requested {} bytes aligned to {}", needed, alignment); });
+        throw std::bad_alloc();
+    }
+
+    remove_free_block(block);
+
+    const auto payload = reinterpret_cast<std::uintptr_t>(block) + occupied_block_metadata_size;
+    size_t padding = align_up(payload, alignment) - payload;
+
+    if (padding != 0 && padding < min_padding)
+    {
+        padding += align_up(min_padding - padding, alignment);
+    }
+
+    if (padding != 0)
+    {
+        void* aligned = static_cast<std::byte*>(block) + padding;
+
+        get_prev_block(aligned) = block;
+        get_next_block(aligned) = get_next_block(block);
+
+        if (get_next_block(aligned) != nullptr)
+        {
+            get_prev_block(get_next_block(aligned)) = aligned;
+        }
+
+        get_next_block(block) = aligned;
+        insert_free_block(block);
+
+        block = aligned;
+    }
+
+    return occupy_block(block, needed);
 }
 
-[[nodiscard]] void *allocator_red_black_tree::do_allocate_sm(
-    size_t size)
+void allocator_red_black_tree::do_deallocate_sm(
+    void *at,
+    size_t)
+{
+    do_deallocate_sm(at);
+}
+
+void* allocator_red_black_tree::get_fit(size_t size) const noexcept
 {
-    throw not_implemented("[[nodiscard]] void *allocator_red_black_tree::do_allocate_sm(size_t)", "your code should be here...");
+    switch (get_fit_mode(_trusted_memory))
+    {
+        case fit_mode::first_fit:
+        case fit_mode::next_fit:
+            return get_first_fit(size);
+        case fit_mode::the_best_fit:
+            return get_best_fit(size);
+        case fit_mode::the_worst_fit:
+            return get_worst_fit(size);
+    }
+
+    return nullptr;
 }
 
+void* allocator_red_black_tree::occupy_block(void* block, size_t needed) noexcept
+{
+    const size_t block_size = get_block_size(block, _trusted_memory);
+
+    if (block_size - needed >= free_block_metadata_size)
+    {
+        void* rest = static_cast<std::byte*>(block) + needed;
+
+        get_block_data(rest).occupied = false;
+        get_prev_block(rest) = block;
+        get_next_block(rest) = get_next_block(block);
+
+        if (get_next_block(rest) != nullptr)
+        {
+            get_prev_block(get_next_block(rest)) = rest;
+        }
+
+        get_next_block(block) = rest;
+        insert_free_block(rest);
+    }
+    else
+    {
+        warning_with_guard([&] { return std::format("[*] changing block size to {} bytes", block_size); });
+    }
+
+    get_block_data(block).occupied = true;
+    get_block_trusted(block) = _trusted_memory;
+
+    void* payload = static_cast<std::byte*>(block) + occupied_block_metadata_size;
+    debug_with_guard([&] { return std::format("[+] allocated {} bytes at {:p}", get_block_size(block, _trusted_memory), payload); });
+
+    return payload;
+}
 
 void allocator_red_black_tree::do_deallocate_sm(
     void *at)
 {
-    throw not_implemented("void allocator_red_black_tree::do_deallocate_sm(void *)", "your code should be here...");
+    debug_with_guard([&] { return std::format("[*] deallocating block {:p}", at); });
+
+    std::lock_guard lock(get_mutex(_trusted_memory));
+
+    void* block = static_cast<std::byte*>(at) - occupied_block_metadata_size;
+
+    if (get_block_trusted(block) != _trusted_memory || !get_block_data(block).occupied)
+    {
+        error_with_guard([&] { return std::format("[!] block doesn't belong to this allocator: {:p}", at); });
+        throw std::logic_error("unknown block");
+    }
+
+    debug_with_guard([&] { return get_dump(static_cast<char*>(at), get_block_size(block, _trusted_memory) - occupied_block_metadata_size); });
+
+    get_block_data(block).occupied = false;
+
+    void* next = get_next_block(block);
+
+    if (next != nullptr && !get_block_data(next).occupied)
+    {
+        remove_free_block(next);
+
+        get_next_block(block) = get_next_block(next);
+        if (get_next_block(block) != nullptr)
+        {
+            get_prev_block(get_next_block(block)) = block;
+        }
+    }
+
+    void* prev = get_prev_block(block);
+
+    if (prev != nullptr && !get_block_data(prev).occupied)
+    {
+        remove_free_block(prev);
+
+        get_next_block(prev) = get_next_block(block);
+        if (get_next_block(prev) != nullptr)
+        {
+            get_prev_block(get_next_block(prev)) = prev;
+        }
+
+        block = prev;
+    }
+
+    insert_free_block(block);
+
+    debug_with_guard([&] { return std::format("[+] block deallocated, free block of {} bytes formed", get_block_size(block, _trusted_memory)); });
 }
 
 void allocator_red_black_tree::set_fit_mode(allocator_with_fit_mode::fit_mode mode)
 {
-    throw not_implemented("void allocator_red_black_tree::set_fit_mode(allocator_with_fit_mode::fit_mode)", "your code should be here...");
+    std::lock_guard lock(get_mutex(_trusted_memory));
+    get_fit_mode(_trusted_memory) = mode;
 }
 
 
 std::vector<allocator_test_utils::block_info> allocator_red_black_tree::get_blocks_info() const
 {
-    throw not_implemented("std::vector<allocator_test_utils::block_info> allocator_red_black_tree::get_blocks_info() const", "your code should be here...");
+    std::lock_guard lock(get_mutex(_trusted_memory));
+    return get_blocks_info_inner();
 }
 
 inline logger *allocator_red_black_tree::get_logger() const
 {
-    throw not_implemented("inline logger *allocator_red_black_tree::get_logger() const", "your code should be here...");
+    return *reinterpret_cast<logger**>(_trusted_memory);
 }
 
 std::vector<allocator_test_utils::block_info> allocator_red_black_tree::get_blocks_info_inner() const
 {
-    throw not_implemented("std::vector<allocator_test_utils::block_info> allocator_red_black_tree::get_blocks_info_inner() const", "your code should be here...");
+    std::vector<allocator_test_utils::block_info> blocks;
+
+    for (auto it = begin(); it != end(); ++it)
+    {
+        blocks.push_back({ it.size(), it.occupied() });
+    }
+
+    return blocks;
 }
 
 inline std::string allocator_red_black_tree::get_typename() const noexcept
 {
-    throw not_implemented("inline std::string allocator_red_black_tree::get_typename() const noexcept", "your code should be here...");
+    return "allocator_red_black_tree";
+}
+
+std::pmr::memory_resource*& allocator_red_black_tree::get_parent_resource(void* trusted_memory) noexcept
+{
+    auto ptr = static_cast<std::byte*>(trusted_memory) + sizeof(logger*);
+    return *reinterpret_cast<std::pmr::memory_resource**>(ptr);
+}
+
+allocator_with_fit_mode::fit_mode& allocator_red_black_tree::get_fit_mode(void* trusted_memory) noexcept
+{
+    auto ptr = static_cast<std::byte*>(trusted_memory) + sizeof(logger*) + sizeof(allocator_dbg_helper*);
+    return *reinterpret_cast<fit_mode*>(ptr);
+}
+
+size_t& allocator_red_black_tree::get_space_size(void* trusted_memory) noexcept
+{
+    auto ptr = static_cast<std::byte*>(trusted_memory) + sizeof(logger*) + sizeof(allocator_dbg_helper*) + sizeof(fit_mode);
+    return *reinterpret_cast<size_t*>(ptr);
+}
+
+std::mutex& allocator_red_black_tree::get_mutex(void* trusted_memory) noexcept
+{
+    auto ptr = static_cast<std::byte*>(trusted_memory) + sizeof(logger*) + sizeof(allocator_dbg_helper*) + sizeof(fit_mode) + sizeof(size_t);
+    return *reinterpret_cast<std::mutex*>(ptr);
+}
+
+void*& allocator_red_black_tree::get_root(void* trusted_memory) noexcept
+{
+    auto ptr = static_cast<std::byte*>(trusted_memory) + allocator_metadata_size - sizeof(void*);
+    return *reinterpret_cast<void**>(ptr);
+}
+
+void* allocator_red_black_tree::get_first_block(void* trusted_memory) noexcept
+{
+    return static_cast<std::byte*>(trusted_memory) + allocator_metadata_size;
+}
+
+allocator_red_black_tree::block_data& allocator_red_black_tree::get_block_data(void* block) noexcept
+{
+    return *static_cast<block_data*>(block);
+}
+
+void*& allocator_red_black_tree::get_prev_block(void* block) noexcept
+{
+    return *reinterpret_cast<void**>(static_cast<std::byte*>(block) + sizeof(block_data));
+}
+
+void*& allocator_red_black_tree::get_next_block(void* block) noexcept
+{
+    return *reinterpret_cast<void**>(static_cast<std::byte*>(block) + sizeof(block_data) + sizeof(void*));
+}
+
+void*& allocator_red_black_tree::get_block_trusted(void* block) noexcept
+{
+    return *reinterpret_cast<void**>(static_cast<std::byte*>(block) + sizeof(block_data) + 2 * sizeof(void*));
+}
+
+void*& allocator_red_black_tree::get_parent_node(void* block) noexcept
+{
+    return *reinterpret_cast<void**>(static_cast<std::byte*>(block) + sizeof(block_data) + 2 * sizeof(void*));
+}
+
+void*& allocator_red_black_tree::get_left_node(void* block) noexcept
+{
+    return *reinterpret_cast<void**>(static_cast<std::byte*>(block) + sizeof(block_data) + 3 * sizeof(void*));
+}
+
+void*& allocator_red_black_tree::get_right_node(void* block) noexcept
+{
+    return *reinterpret_cast<void**>(static_cast<std::byte*>(block) + sizeof(block_data) + 4 * sizeof(void*));
+}
+
+size_t allocator_red_black_tree::get_block_size(void* block, void* trusted_memory) noexcept
+{
+    auto next = static_cast<std::byte*>(get_next_block(block));
+
+    if (next == nullptr)
+    {
+        next = static_cast<std::byte*>(get_first_block(trusted_memory)) + get_space_size(trusted_memory);
+    }
+
+    return next - static_cast<std::byte*>(block);
+}
+
+bool allocator_red_black_tree::is_red(void* node) noexcept
+{
+    return node != nullptr && get_block_data(node).color == block_color::RED;
+}
+
+bool allocator_red_black_tree::is_less(void* left, void* right) const noexcept
+{
+    const size_t left_size = get_block_size(left, _trusted_memory);
+    const size_t right_size = get_block_size(right, _trusted_memory);
+
+    return left_size < right_size || (left_size == right_size && left < right);
+}
+
+void* allocator_red_black_tree::get_first_fit(size_t size) const noexcept
+{
+    for (void* node = get_root(_trusted_memory); node != nullptr; node = get_right_node(node))
+    {
+        if (get_block_size(node, _trusted_memory) >= size)
+        {
+            return node;
+        }
+    }
+
+    return nullptr;
+}
+
+void* allocator_red_black_tree::get_best_fit(size_t size) const noexcept
+{
+    void* result = nullptr;
+
+    for (void* node = get_root(_trusted_memory); node != nullptr;)
+    {
+        if (get_block_size(node, _trusted_memory) >= size)
+        {
+            result = node;
+            node = get_left_node(node);
+        }
+        else
+        {
+            node = get_right_node(node);
+        }
+    }
+
+    return result;
+}
+
+void* allocator_red_black_tree::get_worst_fit(size_t size) const noexcept
+{
+    void* node = get_root(_trusted_memory);
+
+    if (node == nullptr)
+    {
+        return nullptr;
+    }
+
+    while (get_right_node(node) != nullptr)
+    {
+        node = get_right_node(node);
+    }
+
+    return get_block_size(node, _trusted_memory) >= size ? node : nullptr;
+}
+
+void allocator_red_black_tree::rotate_left(void* node) noexcept
+{
+    void* child = get_right_node(node);
+
+    get_right_node(node) = get_left_node(child);
+    if (get_left_node(child) != nullptr)
+    {
+        get_parent_node(get_left_node(child)) = node;
+    }
+
+    transplant(node, child);
+
+    get_left_node(child) = node;
+    get_parent_node(node) = child;
+}
+
+void allocator_red_black_tree::rotate_right(void* node) noexcept
+{
+    void* child = get_left_node(node);
+
+    get_left_node(node) = get_right_node(child);
+    if (get_right_node(child) != nullptr)
+    {
+        get_parent_node(get_right_node(child)) = node;
+    }
+
+    transplant(node, child);
+
+    get_right_node(child) = node;
+    get_parent_node(node) = child;
+}
+
+void allocator_red_black_tree::transplant(void* from, void* to) noexcept
+{
+    void* parent = get_parent_node(from);
+
+    if (parent == nullptr)
+    {
+        get_root(_trusted_memory) = to;
+    }
+    else if (get_left_node(parent) == from)
+    {
+        get_left_node(parent) = to;
+    }
+    else
+    {
+        get_right_node(parent) = to;
+    }
+
+    if (to != nullptr)
+    {
+        get_parent_node(to) = parent;
+    }
+}
+
+void allocator_red_black_tree::insert_free_block(void* block) noexcept
+{
+    void* parent = nullptr;
+
+    for (void* node = get_root(_trusted_memory); node != nullptr;)
+    {
+        parent = node;
+        node = is_less(block, node) ? get_left_node(node) : get_right_node(node);
+    }
+
+    get_parent_node(block) = parent;
+    get_left_node(block) = nullptr;
+    get_right_node(block) = nullptr;
+    get_block_data(block).color = block_color::RED;
+
+    if (parent == nullptr)
+    {
+        get_root(_trusted_memory) = block;
+    }
+    else if (is_less(block, parent))
+    {
+        get_left_node(parent) = block;
+    }
+    else
+    {
+        get_right_node(parent) = block;
+    }
+
+    fix_after_insert(block);
+}
+
+void allocator_red_black_tree::fix_after_insert(void* node) noexcept
+{
+    while (is_red(get_parent_node(node)))
+    {
+        void* parent = get_parent_node(node);
+        void* grandparent = get_parent_node(parent);
+        const bool parent_is_left = get_left_node(grandparent) == parent;
+        void* uncle = parent_is_left ? get_right_node(grandparent) : get_left_node(grandparent);
+
+        if (is_red(uncle))
+        {
+            get_block_data(parent).color = block_color::BLACK;
+            get_block_data(uncle).color = block_color::BLACK;
+            get_block_data(grandparent).color = block_color::RED;
+            node = grandparent;
+            continue;
+        }
+
+        if (parent_is_left && get_right_node(parent) == node)
+        {
+            rotate_left(parent);
+            std::swap(node, parent);
+        }
+        else if (!parent_is_left && get_left_node(parent) == node)
+        {
+            rotate_right(parent);
+            std::swap(node, parent);
+        }
+
+        get_block_data(parent).color = block_color::BLACK;
+        get_block_data(grandparent).color = block_color::RED;
+
+        if (parent_is_left)
+        {
+            rotate_right(grandparent);
+        }
+        else
+        {
+            rotate_left(grandparent);
+        }
+    }
+
+    get_block_data(get_root(_trusted_memory)).color = block_color::BLACK;
+}
+
+void allocator_red_black_tree::remove_free_block(void* block) noexcept
+{
+    void* replacement;
+    void* replacement_parent;
+    block_color removed_color = get_block_data(block).color;
+
+    if (get_left_node(block) == nullptr)
+    {
+        replacement = get_right_node(block);
+        replacement_parent = get_parent_node(block);
+        transplant(block, replacement);
+    }
+    else if (get_right_node(block) == nullptr)
+    {
+        replacement = get_left_node(block);
+        replacement_parent = get_parent_node(block);
+        transplant(block, replacement);
+    }
+    else
+    {
+        void* successor = get_right_node(block);
+        while (get_left_node(successor) != nullptr)
+        {
+            successor = get_left_node(successor);
+        }
+
+        removed_color = get_block_data(successor).color;
+        replacement = get_right_node(successor);
+
+        if (get_parent_node(successor) == block)
+        {
+            replacement_parent = successor;
+        }
+        else
+        {
+            replacement_parent = get_parent_node(successor);
+            transplant(successor, replacement);
+            get_right_node(successor) = get_right_node(block);
+            get_parent_node(get_right_node(successor)) = successor;
+        }
+
+        transplant(block, successor);
+        get_left_node(successor) = get_left_node(block);
+        get_parent_node(get_left_node(successor)) = successor;
+        get_block_data(successor).color = get_block_data(block).color;
+    }
+
+    if (removed_color == block_color::BLACK)
+    {
+        fix_after_remove(replacement, replacement_parent);
+    }
+}
+
+void allocator_red_black_tree::fix_after_remove(void* node, void* parent) noexcept
+{
+    while (node != get_root(_trusted_memory) && !is_red(node))
+    {
+        const bool node_is_left = get_left_node(parent) == node;
+        void* sibling = node_is_left ? get_right_node(parent) : get_left_node(parent);
+
+        if (is_red(sibling))
+        {
+            get_block_data(sibling).color = block_color::BLACK;
+            get_block_data(parent).color = block_color::RED;
+
+            if (node_is_left)
+            {
+                rotate_left(parent);
+                sibling = get_right_node(parent);
+            }
+            else
+            {
+                rotate_right(parent);
+                sibling = get_left_node(parent);
+            }
+        }
+
+        void* near_nephew = node_is_left ? get_left_node(sibling) : get_right_node(sibling);
+        void* far_nephew = node_is_left ? get_right_node(sibling) : get_left_node(sibling);
+
+        if (!is_red(near_nephew) && !is_red(far_nephew))
+        {
+            get_block_data(sibling).color = block_color::RED;
+            node = parent;
+            parent = get_parent_node(node);
+            continue;
+        }
+
+        if (!is_red(far_nephew))
+        {
+            get_block_data(near_nephew).color = block_color::BLACK;
+            get_block_data(sibling).color = block_color::RED;
+
+            if (node_is_left)
+            {
+                rotate_right(sibling);
+                sibling = get_right_node(parent);
+            }
+            else
+            {
+                rotate_left(sibling);
+                sibling = get_left_node(parent);
+            }
+
+            far_nephew = node_is_left ? get_right_node(sibling) : get_left_node(sibling);
+        }
+
+        get_block_data(sibling).color = get_block_data(parent).color;
+        get_block_data(parent).color = block_color::BLACK;
+        get_block_data(far_nephew).color = block_color::BLACK;
+
+        if (node_is_left)
+        {
+            rotate_left(parent);
+        }
+        else
+        {
+            rotate_right(parent);
+        }
+
+        node = get_root(_trusted_memory);
+    }
+
+    if (node != nullptr)
+    {
+        get_block_data(node).color = block_color::BLACK;
+    }
 }
 
 
 allocator_red_black_tree::rb_iterator allocator_red_black_tree::begin() const noexcept
 {
-    throw not_implemented("allocator_red_black_tree::rb_iterator allocator_red_black_tree::begin() const noexcept", "your code should be here...");
+    return {_trusted_memory};
 }
 
 allocator_red_black_tree::rb_iterator allocator_red_black_tree::end() const noexcept
 {
-    throw not_implemented("allocator_red_black_tree::rb_iterator allocator_red_black_tree::end() const noexcept", "your code should be here...");
+    return {};
 }
 
 
 bool allocator_red_black_tree::rb_iterator::operator==(const allocator_red_black_tree::rb_iterator &other) const noexcept
 {
-    throw not_implemented("bool allocator_red_black_tree::rb_iterator::operator==(const allocator_red_black_tree::rb_iterator &) const noexcept", "your code should be here...");
+    return _block_ptr == other._block_ptr;
 }
 
 bool allocator_red_black_tree::rb_iterator::operator!=(const allocator_red_black_tree::rb_iterator &other) const noexcept
 {
-    throw not_implemented("bool allocator_red_black_tree::rb_iterator::operator!=(const allocator_red_black_tree::rb_iterator &) const noexcept", "your code should be here...");
+    return !(*this == other);
 }
 
 allocator_red_black_tree::rb_iterator &allocator_red_black_tree::rb_iterator::operator++() & noexcept
 {
-    throw not_implemented("allocator_red_black_tree::rb_iterator &allocator_red_black_tree::rb_iterator::operator++() & noexcept", "your code should be here...");
+    _block_ptr = get_next_block(_block_ptr);
+    return *this;
 }
 
 allocator_red_black_tree::rb_iterator allocator_red_black_tree::rb_iterator::operator++(int n)
 {
-    throw not_implemented("allocator_red_black_tree::rb_iterator allocator_red_black_tree::rb_iterator::operator++(int)", "your code should be here...");
+    auto tmp = *this;
+    ++(*this);
+    return tmp;
 }
 
 size_t allocator_red_black_tree::rb_iterator::size() const noexcept
 {
-    throw not_implemented("size_t allocator_red_black_tree::rb_iterator::size() const noexcept", "your code should be here...");
+    return get_block_size(_block_ptr, _trusted);
 }
 
 void *allocator_red_black_tree::rb_iterator::operator*() const noexcept
 {
-    throw not_implemented("void *allocator_red_black_tree::rb_iterator::operator*() const noexcept", "your code should be here...");
+    return _block_ptr;
 }
 
 allocator_red_black_tree::rb_iterator::rb_iterator()
+        : _block_ptr(nullptr), _trusted(nullptr)
 {
-    throw not_implemented("allocator_red_black_tree::rb_iterator::rb_iterator()", "your code should be here...");
 }
 
 allocator_red_black_tree::rb_iterator::rb_iterator(void *trusted)
+        : _block_ptr(get_first_block(trusted)), _trusted(trusted)
 {
-    throw not_implemented("allocator_red_black_tree::rb_iterator::rb_iterator(void *)", "your code should be here...");
 }
 
 bool allocator_red_black_tree::rb_iterator::occupied() const noexcept
 {
-    throw not_implemented("bool allocator_red_black_tree::rb_iterator::occupied() const noexcept", "your code should be here...");
+    return get_block_data(_block_ptr).occupied;
 }
@@ -1,4 +1,11 @@
 #include <gtest/gtest.h>
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <random>
+#include <tuple>
+#include <vector>
 #include <logger.h>
 #include <logger_builder.h>
 #include <client_logger_builder.h>
@@ -62,7 +69,7 @@ TEST(allocatorRBTPositiveTests, test1)
 	auto second_block = reinterpret_cast<char *>(alloc->allocate(sizeof(int) * 250));
 	alloc->deallocate(first_block, 1);
 
-	first_block = reinterpret_cast<int *>(alloc->allocate(sizeof(int) * 229));
+	first_block = reinterpret_cast<int *>(alloc->allocate(sizeof(int) * 220));
 
 	auto third_block = reinterpret_cast<int *>(alloc->allocate(sizeof(int) * 250));
 
@@ -220,6 +227,202 @@ TEST(allocatorRBTPositiveTests, test7)
 }
 
 
+TEST(allocatorRBTPositiveTests, test8)
+{
+	std::unique_ptr<smart_mem_resource> allocator(new allocator_red_black_tree(1000, nullptr, nullptr, allocator_with_fit_mode::fit_mode::the_best_fit));
+
+	void* first = allocator->allocate(100);
+	void* second = allocator->allocate(50);
+	void* third = allocator->allocate(100);
+	void* fourth = allocator->allocate(50);
+	void* fifth = allocator->allocate(100);
+
+	allocator->deallocate(fourth, 1);
+	allocator->deallocate(second, 1);
+
+	auto actual_blocks_state = dynamic_cast<allocator_test_utils *>(allocator.get())->get_blocks_info();
+	ASSERT_EQ(actual_blocks_state.size(), 6);
+	ASSERT_EQ(actual_blocks_state[1], actual_blocks_state[3]);
+	ASSERT_FALSE(actual_blocks_state[1].is_block_occupied);
+	ASSERT_FALSE(actual_blocks_state[5].is_block_occupied);
+
+	ASSERT_EQ(allocator->allocate(40), second);
+
+	allocator->deallocate(first, 1);
+	allocator->deallocate(third, 1);
+	allocator->deallocate(fifth, 1);
+	allocator->deallocate(second, 1);
+
+	actual_blocks_state = dynamic_cast<allocator_test_utils *>(allocator.get())->get_blocks_info();
+	ASSERT_EQ(actual_blocks_state.size(), 1);
+	ASSERT_EQ(actual_blocks_state[0], (allocator_test_utils::block_info{ .block_size = 1000, .is_block_occupied = false }));
+}
+
+TEST(allocatorRBTPositiveTests, test9)
+{
+	std::unique_ptr<smart_mem_resource> allocator(new allocator_red_black_tree(16000, nullptr, nullptr, allocator_with_fit_mode::fit_mode::first_fit));
+	
+	std::vector<std::tuple<void *, size_t, size_t>> blocks;
+	
+	for (size_t alignment = 1; alignment <= 64; alignment <<= 1)
+	{
+		for (size_t size : { 1, 3, 8, 16, 100 })
+		{
+			void *block = allocator->allocate(size, alignment);
+			
+			ASSERT_EQ(reinterpret_cast<std::uintptr_t>(block) % alignment, 0) << "size " << size << ", alignment " << alignment;
+			std::memset(block, 0xAB, size);
+			blocks.emplace_back(block, size, alignment);
+		}
+	}
+	
+	for (auto [block, size, alignment] : blocks)
+	{
+		allocator->deallocate(block, size, alignment);
+	}
+	
+	auto actual_blocks_state = dynamic_cast<allocator_test_utils *>(allocator.get())->get_blocks_info();
+	
+	ASSERT_EQ(actual_blocks_state.size(), 1);
+	ASSERT_EQ(actual_blocks_state[0], (allocator_test_utils::block_info{ .block_size = 16000, .is_block_occupied = false }));
+}
+
+TEST(allocatorRBTPositiveTests, test10)
+{
+	constexpr size_t space_size = 1 << 16;
+	
+	for (auto mode : { allocator_with_fit_mode::fit_mode::first_fit, allocator_with_fit_mode::fit_mode::the_best_fit, allocator_with_fit_mode::fit_mode::the_worst_fit })
+	{
+		std::unique_ptr<smart_mem_resource> allocator(new allocator_red_black_tree(space_size, nullptr, nullptr, mode));
+		auto *utils = dynamic_cast<allocator_test_utils *>(allocator.get());
+		
+		std::mt19937 engine(static_cast<unsigned>(mode) + 1);
+		std::vector<std::tuple<unsigned char *, size_t, unsigned char>> blocks;
+		
+		for (int i = 0; i < 5000; ++i)
+		{
+			if (blocks.empty() || engine() % 3 != 0)
+			{
+				const size_t size = engine() % 512;
+				const auto tag = static_cast<unsigned char>(i);
+				
+				try
+				{
+					auto *block = reinterpret_cast<unsigned char *>(allocator->allocate(size));
+					std::memset(block, tag, size);
+					blocks.emplace_back(block, size, tag);
+				}
+				catch (std::bad_alloc const &)
+				{
+				}
+			}
+			else
+			{
+				const size_t index = engine() % blocks.size();
+				auto [block, size, tag] = blocks[index];
+				
+				for (size_t j = 0; j < size; ++j)
+				{
+					ASSERT_EQ(block[j], tag);
+				}
+				
+				allocator->deallocate(block, size);
+				blocks[index] = blocks.back();
+				blocks.pop_back();
+			}
+			
+			auto actual_blocks_state = utils->get_blocks_info();
+			size_t total_size = 0;
+			
+			for (size_t j = 0; j < actual_blocks_state.size(); ++j)
+			{
+				total_size += actual_blocks_state[j].block_size;
+				
+				// free neighbours have to be coalesced
+				ASSERT_FALSE(j > 0 && !actual_blocks_state[j - 1].is_block_occupied && !actual_blocks_state[j].is_block_occupied);
+			}
+			
+			ASSERT_EQ(total_size, space_size);
+			ASSERT_EQ(std::count_if(actual_blocks_state.begin(), actual_blocks_state.end(),
+				[](auto const &block) { return block.is_block_occupied; }), blocks.size());
+		}
+		
+		for (auto [block, size, tag] : blocks)
+		{
+			allocator->deallocate(block, size);
+		}
+		
+		auto actual_blocks_state = utils->get_blocks_info();
+		
+		ASSERT_EQ(actual_blocks_state.size(), 1);
+		ASSERT_EQ(actual_blocks_state[0], (allocator_test_utils::block_info{ .block_size = space_size, .is_block_occupied = false }));
+	}
+}
+
+TEST(allocatorRBTPositiveTests, test11)
+{
+	std::unique_ptr<smart_mem_resource> allocator(new allocator_red_black_tree(4096, nullptr, nullptr, allocator_with_fit_mode::fit_mode::first_fit));
+	auto *utils = dynamic_cast<allocator_test_utils *>(allocator.get());
+	
+	void *first_block = allocator->allocate(8);
+	void *aligned_block = allocator->allocate(100, 256);
+	
+	ASSERT_EQ(reinterpret_cast<std::uintptr_t>(aligned_block) % 256, 0);
+	
+	// the block is split around the aligned payload instead of taking alignment bytes more,
+	// padding before it is left free
+	auto actual_blocks_state = utils->get_blocks_info();
+	auto aligned_block_info = std::find_if(actual_blocks_state.begin() + 1, actual_blocks_state.end(),
+		[](auto const &block) { return block.is_block_occupied; });
+	
+	ASSERT_NE(aligned_block_info, actual_blocks_state.end());
+	ASSERT_LT(aligned_block_info->block_size, 256);
+	ASSERT_TRUE(aligned_block_info - actual_blocks_state.begin() == 1 || !(aligned_block_info - 1)->is_block_occupied);
+	
+	allocator->deallocate(aligned_block, 100, 256);
+	
+	actual_blocks_state = utils->get_blocks_info();
+	
+	ASSERT_EQ(actual_blocks_state.size(), 2);
+	ASSERT_FALSE(actual_blocks_state[1].is_block_occupied);
+	
+	allocator->deallocate(first_block, 8);
+	
+	actual_blocks_state = utils->get_blocks_info();
+	
+	ASSERT_EQ(actual_blocks_state.size(), 1);
+	ASSERT_EQ(actual_blocks_state[0], (allocator_test_utils::block_info{ .block_size = 4096, .is_block_occupied = false }));
+}
+
+TEST(allocatorRBTNegativeTests, test1)
+{
+	std::unique_ptr<smart_mem_resource> allocator(new allocator_red_black_tree(1000, nullptr, nullptr, allocator_with_fit_mode::fit_mode::first_fit));
+	
+	// size with the block header would wrap around
+	ASSERT_THROW(static_cast<void>(allocator->allocate(std::numeric_limits<size_t>::max() - 8)), std::bad_alloc);
+	
+	auto actual_blocks_state = dynamic_cast<allocator_test_utils *>(allocator.get())->get_blocks_info();
+	
+	ASSERT_EQ(actual_blocks_state.size(), 1);
+	ASSERT_EQ(actual_blocks_state[0], (allocator_test_utils::block_info{ .block_size = 1000, .is_block_occupied = false }));
+}
+
+TEST(allocatorRBTNegativeTests, test2)
+{
+	std::unique_ptr<smart_mem_resource> allocator(new allocator_red_black_tree(3000, nullptr, nullptr, allocator_with_fit_mode::fit_mode::first_fit));
+	
+	// size with the block header or the alignment padding would wrap around
+	for (size_t alignment : { 8, 64 })
+	{
+		ASSERT_THROW(static_cast<void>(allocator->allocate(std::numeric_limits<size_t>::max() - 20, alignment)), std::bad_alloc);
+	}
+	
+	auto actual_blocks_state = dynamic_cast<allocator_test_utils *>(allocator.get())->get_blocks_info();
+	
+	ASSERT_EQ(actual_blocks_state.size(), 1);
+	ASSERT_EQ(actual_blocks_state[0], (allocator_test_utils::block_info{ .block_size = 3000, .is_block_occupied = false }));
+}
+
 int main(
     int argc,
     char *argv[])
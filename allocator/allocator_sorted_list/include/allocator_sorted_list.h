@@ -21,23 +21,45 @@ private:
     
     void *_trusted_memory;
 
-    static constexpr const size_t allocator_metadata_size = sizeof(logger*) + sizeof(std::pmr::memory_resource *) + sizeof(fit_mode) + sizeof(size_t) + sizeof(std::mutex) + sizeof(void*);
-
+    /** Levels of the skip index over the address-sorted free list, level 0 is the free list itself.
+     *  A tower reaches every next level with probability 1/4
+     */
+    static constexpr const size_t skip_levels = 8;
+
+    /** Allocator metadata keeps the number of index levels in use after the mutex and ends with the roving pointer
+     *  of next_fit and heads of the skip index levels. It is padded to max_align_t as block sizes are,
+     *  so payloads are aligned to it
+     */
+    static constexpr const size_t allocator_metadata_size = align_up(sizeof(logger*) + sizeof(std::pmr::memory_resource *) + sizeof(fit_mode) + sizeof(size_t) + sizeof(std::mutex) + sizeof(size_t) + sizeof(void*) + skip_levels * sizeof(void*));
+
+    /** Every block starts with its size, header included, and a pointer: trusted memory for occupied blocks,
+     *  next free block for free ones. With the skip index on, free blocks then keep the height of their tower
+     *  and forward pointers of the levels above 0
+     */
     static constexpr const size_t block_metadata_size = sizeof(void*) + sizeof(size_t);
 
+    /** With the index on, every free block has room for a full tower, so that even the smallest fragments
+     *  get towers of any height and the index does not degrade to a list when they dominate
+     */
+    static constexpr const size_t indexed_free_block_metadata_size = block_metadata_size + sizeof(size_t) + (skip_levels - 1) * sizeof(void*);
+
 public:
 
+    /** Skip index makes deallocation O(log n) in the number of free blocks instead of O(n),
+     *  at the cost of raising the minimum block to indexed_free_block_metadata_size
+     */
     explicit allocator_sorted_list(
             size_t space_size,
             std::pmr::memory_resource *parent_allocator = nullptr,
             logger *logger = nullptr,
-            allocator_with_fit_mode::fit_mode allocate_fit_mode = allocator_with_fit_mode::fit_mode::first_fit);
+            allocator_with_fit_mode::fit_mode allocate_fit_mode = allocator_with_fit_mode::fit_mode::first_fit,
+            bool use_skip_index = false);
     
     allocator_sorted_list(
-        allocator_sorted_list const &other);
+        allocator_sorted_list const &other) = delete;
     
     allocator_sorted_list &operator=(
-        allocator_sorted_list const &other);
+        allocator_sorted_list const &other) = delete;
 
     allocator_sorted_list(
         allocator_sorted_list &&other) noexcept;
@@ -53,12 +75,22 @@ public:
     void do_deallocate_sm(
         void *at) override;
 
+    /** Block is split so that the payload is aligned, padding before its header stays a free block
+     */
+    [[nodiscard]] void *do_allocate_sm(
+        size_t size,
+        size_t alignment) override;
+
+    void do_deallocate_sm(
+        void *at,
+        size_t alignment) override;
+
     bool do_is_equal(const std::pmr::memory_resource&) const noexcept override;
     
     inline void set_fit_mode(
         allocator_with_fit_mode::fit_mode mode) override;
 
-    std::vector<allocator_test_utils::block_info> get_blocks_info() const noexcept override;
+    std::vector<allocator_test_utils::block_info> get_blocks_info() const override;
 
 private:
 
@@ -66,7 +98,72 @@ private:
     
     inline logger *get_logger() const override;
     
-    inline std::string get_typename() const override;
+    inline std::string get_typename() const noexcept override;
+
+    static std::pmr::memory_resource*& get_parent_resource(void* trusted_memory) noexcept;
+
+    static fit_mode& get_fit_mode(void* trusted_memory) noexcept;
+
+    static size_t& get_space_size(void* trusted_memory) noexcept;
+
+    static std::mutex& get_mutex(void* trusted_memory) noexcept;
+
+    /** skip_levels with the index on, 1 with it off
+     */
+    static size_t& get_index_levels(void* trusted_memory) noexcept;
+
+    /** Smallest block that can be free: header only, or header with a full tower if the index is on
+     */
+    static size_t get_free_block_metadata_size(void* trusted_memory) noexcept;
+
+    static void*& get_roving_block(void* trusted_memory) noexcept;
+
+    static void* get_first_block(void* trusted_memory) noexcept;
+
+    static size_t& get_block_size(void* block) noexcept;
+
+    static void*& get_block_pointer(void* block) noexcept;
+
+    static size_t& get_block_height(void* block) noexcept;
+
+    /** Height of the tower of a free block, 1 if the index is off and no height is stored
+     */
+    static size_t get_tower_height(void* trusted_memory, void* block) noexcept;
+
+    /** Forward pointer of the free block on the level, heads of the levels for nullptr
+     */
+    static void*& get_forward(void* trusted_memory, void* block, size_t level) noexcept;
+
+    /** Tower height for a free block being indexed: geometric by address hash
+     */
+    static size_t get_height(void* trusted_memory, void* block) noexcept;
+
+    /** Last free block before block on every level, nullptr stands for the heads
+     */
+    void find_predecessors(void* block, void** update) const noexcept;
+
+    void insert_free_block(void* block, void** update) noexcept;
+
+    void remove_free_block(void* block, void** update) noexcept;
+
+    void* get_first_fit(size_t size) const noexcept;
+
+    void* get_best_fit(size_t size) const noexcept;
+
+    void* get_worst_fit(size_t size) const noexcept;
+
+    /** First fitting block at or after the roving pointer, wrapping around to the list start
+     */
+    void* get_next_fit(size_t size) const noexcept;
+
+    /** Free block of at least size bytes chosen by the fit mode, nullptr if there is none
+     */
+    void* get_fit(size_t size) const noexcept;
+
+    /** Occupies free block taken out of the list, rest of it after needed bytes is split off if it can be free.
+     *  update holds predecessors of the block, next is the free block after it
+     */
+    void* occupy_block(void* block, size_t needed, void** update, void* next) noexcept;
 
     class sorted_free_iterator
     {
@@ -1,190 +1,649 @@
-#include <not_implemented.h>
 #include "../include/allocator_sorted_list.h"
+#include <algorithm>
+#include <bit>
+#include <cstdint>
+#include <format>
+#include <memory>
 
 allocator_sorted_list::~allocator_sorted_list()
 {
-    throw not_implemented("allocator_sorted_list::~allocator_sorted_list()", "your code should be here...");
+    if (_trusted_memory == nullptr)
+    {
+        return;
+    }
+
+    debug_with_guard("[*] allocator destructor started");
+
+    get_mutex(_trusted_memory).~mutex();
+    get_parent_resource(_trusted_memory)->deallocate(_trusted_memory, allocator_metadata_size + get_space_size(_trusted_memory));
 }
 
 allocator_sorted_list::allocator_sorted_list(
     allocator_sorted_list &&other) noexcept
+        : _trusted_memory(std::exchange(other._trusted_memory, nullptr))
 {
-    throw not_implemented("allocator_sorted_list::allocator_sorted_list(allocator_sorted_list &&) noexcept", "your code should be here...");
 }
 
 allocator_sorted_list &allocator_sorted_list::operator=(
     allocator_sorted_list &&other) noexcept
 {
-    throw not_implemented("allocator_sorted_list &allocator_sorted_list::operator=(allocator_sorted_list &&) noexcept", "your code should be here...");
+    if (this != &other)
+    {
+        std::swap(_trusted_memory, other._trusted_memory);
+    }
+
+    return *this;
 }
 
 allocator_sorted_list::allocator_sorted_list(
         size_t space_size,
         std::pmr::memory_resource *parent_allocator,
         logger *logger,
-        allocator_with_fit_mode::fit_mode allocate_fit_mode)
+        allocator_with_fit_mode::fit_mode allocate_fit_mode,
+        bool use_skip_index)
 {
-    throw not_implemented("allocator_sorted_list::allocator_sorted_list(size_t, std::pmr::memory_resource *,logger *,allocator_with_fit_mode::fit_mode)", "your code should be here...");
+    if (space_size < (use_skip_index ? indexed_free_block_metadata_size : block_metadata_size))
+    {
+        throw std::logic_error("`space_size` is not enough to fit a single block");
+    }
+
+    const auto allocator = parent_allocator != nullptr ? parent_allocator : std::pmr::get_default_resource();
+
+    _trusted_memory = allocator->allocate(allocator_metadata_size + space_size);
+
+    *reinterpret_cast<class logger**>(_trusted_memory) = logger;
+    get_parent_resource(_trusted_memory) = allocator;
+    get_fit_mode(_trusted_memory) = allocate_fit_mode;
+    get_space_size(_trusted_memory) = space_size;
+    std::construct_at(&get_mutex(_trusted_memory));
+    get_index_levels(_trusted_memory) = use_skip_index ? skip_levels : 1;
+    get_roving_block(_trusted_memory) = nullptr;
+
+    void* update[skip_levels];
+
+    for (size_t level = 0; level < skip_levels; ++level)
+    {
+        get_forward(_trusted_memory, nullptr, level) = nullptr;
+        update[level] = nullptr;
+    }
+
+    void* block = get_first_block(_trusted_memory);
+    get_block_size(block) = space_size;
+    insert_free_block(block, update);
+
+    debug_with_guard([&] { return std::format("[+] allocator created with {} bytes", space_size); });
 }
 
 [[nodiscard]] void *allocator_sorted_list::do_allocate_sm(
     size_t size)
 {
-    throw not_implemented("[[nodiscard]] void *allocator_sorted_list::do_allocate_sm(size_t)", "your code should be here...");
+    if (size > get_space_size(_trusted_memory))
+    {
+        error_with_guard([&] { return std::format("[!] out of memory: requested {} bytes", size); });
+        throw std::bad_alloc();
+    }
+
+    const size_t needed = align_up(std::max(size + block_metadata_size, get_free_block_metadata_size(_trusted_memory)));
+    debug_with_guard([&] { return std::format("[*] allocating {} bytes", needed); });
+
+    std::lock_guard lock(get_mutex(_trusted_memory));
+
+    void* block = get_fit(needed);
+
+    if (block == nullptr)
+    {
+        error_with_guard([&] { return std::format("[!] out of memory: requested {} bytes", needed); });
+        throw std::bad_alloc();
+    }
+
+    void* update[skip_levels];
+    find_predecessors(block, update);
+
+    void* next = get_forward(_trusted_memory, block, 0);
+    remove_free_block(block, update);
+
+    return occupy_block(block, needed, update, next);
+}
+
+[[nodiscard]] void *allocator_sorted_list::do_allocate_sm(
+    size_t size,
+    size_t alignment)
+{
+    if (size > get_space_size(_trusted_memory) || alignment > get_space_size(_trusted_memory))
+    {
+        error_with_guard([&] { return std::format("[!] out of memory: requested {} bytes aligned to {}", size, alignment); });
+        throw std::bad_alloc();
+    }
+
+    const size_t needed = align_up(std::max(size + block_metadata_size, get_free_block_metadata_size(_trusted_memory)));
+    const size_t min_padding = align_up(get_free_block_metadata_size(_trusted_memory));
+    debug_with_guard([&] { return std::format("[*] allocating {} bytes aligned to {}", needed, alignment); });
+
+    std::lock_guard lock(get_mutex(_trusted_memory));
+
+    // padding before the header is either empty or a free block, so it takes less than alignment + min_padding
+    void* block = get_fit(needed + alignment + min_padding);
+
+    if (block == nullptr)
+    {
+        error_with_guard([&] { return std::format("[!] out of memory: requested {} bytes aligned to {}", needed, alignment); });
+        throw std::bad_alloc();
+    }
+
+    void* update[skip_levels];
+    find_predecessors(block, update);
+
+    void* next = get_forward(_trusted_memory, block, 0);
+    remove_free_block(block, update);
+
+    const auto payload = reinterpret_cast<std::uintptr_t>(block) + block_metadata_size;
+    size_t padding = align_up(payload, alignment) - payload;
+
+    if (padding != 0 && padding < min_padding)
+    {
+        padding += align_up(min_padding - padding, alignment);
+    }
+
+    if (padding != 0)
+    {
+        void* aligned = static_cast<std::byte*>(block) + padding;
+
+        get_block_size(aligned) = get_block_size(block) - padding;
+        get_block_size(block) = padding;
+        insert_free_block(block, update);
+
+        for (size_t level = 0; level < get_tower_height(_trusted_memory, block); ++level)
+        {
+            update[level] = block;
+        }
+
+        block = aligned;
+    }
+
+    return occupy_block(block, needed, update, next);
+}
+
+void allocator_sorted_list::do_deallocate_sm(
+    void *at,
+    size_t)
+{
+    do_deallocate_sm(at);
 }
 
-allocator_sorted_list::allocator_sorted_list(const allocator_sorted_list &other)
+void* allocator_sorted_list::get_fit(size_t size) const noexcept
 {
-    throw not_implemented("allocator_sorted_list::allocator_sorted_list(const allocator_sorted_list &other)", "your code should be here...");
+    switch (get_fit_mode(_trusted_memory))
+    {
+        case fit_mode::first_fit:
+            return get_first_fit(size);
+        case fit_mode::the_best_fit:
+            return get_best_fit(size);
+        case fit_mode::the_worst_fit:
+            return get_worst_fit(size);
+        case fit_mode::next_fit:
+            return get_next_fit(size);
+    }
+
+    return nullptr;
 }
 
-allocator_sorted_list &allocator_sorted_list::operator=(const allocator_sorted_list &other)
+void* allocator_sorted_list::occupy_block(void* block, size_t needed, void** update, void* next) noexcept
 {
-    throw not_implemented("allocator_sorted_list &allocator_sorted_list::operator=(const allocator_sorted_list &other)", "your code should be here...");
+    const size_t block_size = get_block_size(block);
+
+    if (block_size - needed >= get_free_block_metadata_size(_trusted_memory))
+    {
+        void* rest = static_cast<std::byte*>(block) + needed;
+
+        get_block_size(rest) = block_size - needed;
+        get_block_size(block) = needed;
+
+        insert_free_block(rest, update);
+        next = rest;
+    }
+    else
+    {
+        warning_with_guard([&] { return std::format("[*] changing block size to {} bytes", block_size); });
+    }
+
+    get_roving_block(_trusted_memory) = next;
+    get_block_pointer(block) = _trusted_memory;
+
+    void* payload = static_cast<std::byte*>(block) + block_metadata_size;
+    debug_with_guard([&] { return std::format("[+] allocated {} bytes at {:p}", get_block_size(block), payload); });
+
+    return payload;
 }
 
 bool allocator_sorted_list::do_is_equal(const std::pmr::memory_resource &other) const noexcept
 {
-    throw not_implemented("bool allocator_sorted_list::do_is_equal(const std::pmr::memory_resource &other) const noexcept", "your code should be here...");
+    return this == &other;
 }
 
 void allocator_sorted_list::do_deallocate_sm(
     void *at)
 {
-    throw not_implemented("void allocator_sorted_list::do_deallocate_sm(void *)", "your code should be here...");
+    debug_with_guard([&] { return std::format("[*] deallocating block {:p}", at); });
+
+    std::lock_guard lock(get_mutex(_trusted_memory));
+
+    void* block = static_cast<std::byte*>(at) - block_metadata_size;
+
+    if (get_block_pointer(block) != _trusted_memory)
+    {
+        error_with_guard([&] { return std::format("[!] block doesn't belong to this allocator: {:p}", at); });
+        throw std::logic_error("unknown block");
+    }
+
+    debug_with_guard([&] { return get_dump(static_cast<char*>(at), get_block_size(block) - block_metadata_size); });
+
+    void* update[skip_levels];
+    find_predecessors(block, update);
+
+    void* prev = update[0];
+    void* next = get_forward(_trusted_memory, prev, 0);
+
+    if (next == block || (prev != nullptr && static_cast<std::byte*>(prev) + get_block_size(prev) > block))
+    {
+        error_with_guard([&] { return std::format("[!] block is already free: {:p}", at); });
+        throw std::logic_error("block is already free");
+    }
+
+    bool roving_merged = false;
+
+    if (next == static_cast<std::byte*>(block) + get_block_size(block))
+    {
+        roving_merged = get_roving_block(_trusted_memory) == next;
+        remove_free_block(next, update);
+        get_block_size(block) += get_block_size(next);
+    }
+
+    if (prev != nullptr && static_cast<std::byte*>(prev) + get_block_size(prev) == block)
+    {
+        // Growing in place keeps the tower of prev valid, it only gets more room
+        get_block_size(prev) += get_block_size(block);
+        block = prev;
+    }
+    else
+    {
+        insert_free_block(block, update);
+    }
+
+    if (roving_merged)
+    {
+        get_roving_block(_trusted_memory) = block;
+    }
+
+    debug_with_guard([&] { return std::format("[+] block deallocated, free block of {} bytes formed", get_block_size(block)); });
 }
 
 inline void allocator_sorted_list::set_fit_mode(
     allocator_with_fit_mode::fit_mode mode)
 {
-    throw not_implemented("inline void allocator_sorted_list::set_fit_mode(allocator_with_fit_mode::fit_mode)", "your code should be here...");
+    std::lock_guard lock(get_mutex(_trusted_memory));
+    get_fit_mode(_trusted_memory) = mode;
 }
 
-std::vector<allocator_test_utils::block_info> allocator_sorted_list::get_blocks_info() const noexcept
+std::vector<allocator_test_utils::block_info> allocator_sorted_list::get_blocks_info() const
 {
-    throw not_implemented("std::vector<allocator_test_utils::block_info> allocator_sorted_list::get_blocks_info() const noexcept", "your code should be here...");
+    std::lock_guard lock(get_mutex(_trusted_memory));
+    return get_blocks_info_inner();
 }
 
 inline logger *allocator_sorted_list::get_logger() const
 {
-    throw not_implemented("inline logger *allocator_sorted_list::get_logger() const", "your code should be here...");
+    return *reinterpret_cast<logger**>(_trusted_memory);
 }
 
-inline std::string allocator_sorted_list::get_typename() const
+inline std::string allocator_sorted_list::get_typename() const noexcept
 {
-    throw not_implemented("inline std::string allocator_sorted_list::get_typename() const", "your code should be here...");
+    return "allocator_sorted_list";
 }
 
-
 std::vector<allocator_test_utils::block_info> allocator_sorted_list::get_blocks_info_inner() const
 {
-    throw not_implemented("std::vector<allocator_test_utils::block_info> allocator_sorted_list::get_blocks_info_inner() const", "your code should be here...");
+    std::vector<allocator_test_utils::block_info> blocks;
+
+    for (auto it = begin(); it != end(); ++it)
+    {
+        blocks.push_back({ it.size(), it.occupied() });
+    }
+
+    return blocks;
+}
+
+std::pmr::memory_resource*& allocator_sorted_list::get_parent_resource(void* trusted_memory) noexcept
+{
+    auto ptr = static_cast<std::byte*>(trusted_memory) + sizeof(logger*);
+    return *reinterpret_cast<std::pmr::memory_resource**>(ptr);
+}
+
+allocator_with_fit_mode::fit_mode& allocator_sorted_list::get_fit_mode(void* trusted_memory) noexcept
+{
+    auto ptr = static_cast<std::byte*>(trusted_memory) + sizeof(logger*) + sizeof(std::pmr::memory_resource*);
+    return *reinterpret_cast<fit_mode*>(ptr);
+}
+
+size_t& allocator_sorted_list::get_space_size(void* trusted_memory) noexcept
+{
+    auto ptr = static_cast<std::byte*>(trusted_memory) + sizeof(logger*) + sizeof(std::pmr::memory_resource*) + sizeof(fit_mode);
+    return *reinterpret_cast<size_t*>(ptr);
+}
+
+std::mutex& allocator_sorted_list::get_mutex(void* trusted_memory) noexcept
+{
+    auto ptr = static_cast<std::byte*>(trusted_memory) + sizeof(logger*) + sizeof(std::pmr::memory_resource*) + sizeof(fit_mode) + sizeof(size_t);
+    return *reinterpret_cast<std::mutex*>(ptr);
+}
+
+size_t& allocator_sorted_list::get_index_levels(void* trusted_memory) noexcept
+{
+    auto ptr = static_cast<std::byte*>(trusted_memory) + sizeof(logger*) + sizeof(std::pmr::memory_resource*) + sizeof(fit_mode) + sizeof(size_t) + sizeof(std::mutex);
+    return *reinterpret_cast<size_t*>(ptr);
+}
+
+size_t allocator_sorted_list::get_free_block_metadata_size(void* trusted_memory) noexcept
+{
+    return get_index_levels(trusted_memory) > 1 ? indexed_free_block_metadata_size : block_metadata_size;
+}
+
+void*& allocator_sorted_list::get_roving_block(void* trusted_memory) noexcept
+{
+    auto ptr = static_cast<std::byte*>(trusted_memory) + allocator_metadata_size - (skip_levels + 1) * sizeof(void*);
+    return *reinterpret_cast<void**>(ptr);
+}
+
+void* allocator_sorted_list::get_first_block(void* trusted_memory) noexcept
+{
+    return static_cast<std::byte*>(trusted_memory) + allocator_metadata_size;
+}
+
+size_t& allocator_sorted_list::get_block_size(void* block) noexcept
+{
+    return *static_cast<size_t*>(block);
+}
+
+void*& allocator_sorted_list::get_block_pointer(void* block) noexcept
+{
+    return *reinterpret_cast<void**>(static_cast<std::byte*>(block) + sizeof(size_t));
+}
+
+size_t& allocator_sorted_list::get_block_height(void* block) noexcept
+{
+    return *reinterpret_cast<size_t*>(static_cast<std::byte*>(block) + block_metadata_size);
+}
+
+size_t allocator_sorted_list::get_tower_height(void* trusted_memory, void* block) noexcept
+{
+    return get_index_levels(trusted_memory) > 1 ? get_block_height(block) : 1;
+}
+
+void*& allocator_sorted_list::get_forward(void* trusted_memory, void* block, size_t level) noexcept
+{
+    if (block == nullptr)
+    {
+        auto ptr = static_cast<std::byte*>(trusted_memory) + allocator_metadata_size - (skip_levels - level) * sizeof(void*);
+        return *reinterpret_cast<void**>(ptr);
+    }
+
+    if (level == 0)
+    {
+        return get_block_pointer(block);
+    }
+
+    auto ptr = static_cast<std::byte*>(block) + block_metadata_size + sizeof(size_t) + (level - 1) * sizeof(void*);
+    return *reinterpret_cast<void**>(ptr);
+}
+
+size_t allocator_sorted_list::get_height(void* trusted_memory, void* block) noexcept
+{
+    if (get_index_levels(trusted_memory) == 1)
+    {
+        return 1;
+    }
+
+    const std::uint64_t hash = static_cast<std::uint64_t>(reinterpret_cast<std::uintptr_t>(block) >> 4) * 0x9E3779B97F4A7C15ull;
+
+    return std::min(static_cast<size_t>(std::countl_zero(hash)) / 2 + 1, skip_levels);
+}
+
+void allocator_sorted_list::find_predecessors(void* block, void** update) const noexcept
+{
+    void* current = nullptr;
+
+    for (size_t level = get_index_levels(_trusted_memory); level-- > 0;)
+    {
+        for (void* next = get_forward(_trusted_memory, current, level); next != nullptr && next < block; next = get_forward(_trusted_memory, current, level))
+        {
+            current = next;
+        }
+
+        update[level] = current;
+    }
+}
+
+void allocator_sorted_list::insert_free_block(void* block, void** update) noexcept
+{
+    const size_t height = get_height(_trusted_memory, block);
+
+    if (get_index_levels(_trusted_memory) > 1)
+    {
+        get_block_height(block) = height;
+    }
+
+    for (size_t level = 0; level < height; ++level)
+    {
+        get_forward(_trusted_memory, block, level) = get_forward(_trusted_memory, update[level], level);
+        get_forward(_trusted_memory, update[level], level) = block;
+    }
+}
+
+void allocator_sorted_list::remove_free_block(void* block, void** update) noexcept
+{
+    for (size_t level = 0; level < get_tower_height(_trusted_memory, block); ++level)
+    {
+        get_forward(_trusted_memory, update[level], level) = get_forward(_trusted_memory, block, level);
+    }
+
+    if (get_roving_block(_trusted_memory) == block)
+    {
+        get_roving_block(_trusted_memory) = get_forward(_trusted_memory, block, 0);
+    }
+}
+
+void* allocator_sorted_list::get_first_fit(size_t size) const noexcept
+{
+    for (auto it = free_begin(); it != free_end(); ++it)
+    {
+        if (it.size() >= size)
+        {
+            return *it;
+        }
+    }
+
+    return nullptr;
+}
+
+void* allocator_sorted_list::get_best_fit(size_t size) const noexcept
+{
+    void* best = nullptr;
+    size_t best_size = 0;
+
+    for (auto it = free_begin(); it != free_end(); ++it)
+    {
+        if (it.size() >= size && (best == nullptr || it.size() < best_size))
+        {
+            best = *it;
+            best_size = it.size();
+        }
+    }
+
+    return best;
+}
+
+void* allocator_sorted_list::get_worst_fit(size_t size) const noexcept
+{
+    void* worst = nullptr;
+    size_t worst_size = 0;
+
+    for (auto it = free_begin(); it != free_end(); ++it)
+    {
+        if (it.size() >= size && it.size() > worst_size)
+        {
+            worst = *it;
+            worst_size = it.size();
+        }
+    }
+
+    return worst;
+}
+
+void* allocator_sorted_list::get_next_fit(size_t size) const noexcept
+{
+    void* roving = get_roving_block(_trusted_memory);
+
+    for (void* block = roving; block != nullptr; block = get_forward(_trusted_memory, block, 0))
+    {
+        if (get_block_size(block) >= size)
+        {
+            return block;
+        }
+    }
+
+    for (auto it = free_begin(); it != free_end() && *it != roving; ++it)
+    {
+        if (it.size() >= size)
+        {
+            return *it;
+        }
+    }
+
+    return nullptr;
 }
 
 allocator_sorted_list::sorted_free_iterator allocator_sorted_list::free_begin() const noexcept
 {
-    throw not_implemented("allocator_sorted_list::sorted_free_iterator allocator_sorted_list::free_begin() const noexcept", "your code should be here...");
+    return { _trusted_memory };
 }
 
 allocator_sorted_list::sorted_free_iterator allocator_sorted_list::free_end() const noexcept
 {
-    throw not_implemented("allocator_sorted_list::sorted_free_iterator allocator_sorted_list::free_end() const noexcept", "your code should be here...");
+    return {};
 }
 
 allocator_sorted_list::sorted_iterator allocator_sorted_list::begin() const noexcept
 {
-    throw not_implemented("allocator_sorted_list::sorted_iterator allocator_sorted_list::begin() const noexcept", "your code should be here...");
+    return { _trusted_memory };
 }
 
 allocator_sorted_list::sorted_iterator allocator_sorted_list::end() const noexcept
 {
-    throw not_implemented("allocator_sorted_list::sorted_iterator allocator_sorted_list::end() const noexcept", "your code should be here...");
+    return {};
 }
 
 
 bool allocator_sorted_list::sorted_free_iterator::operator==(
         const allocator_sorted_list::sorted_free_iterator & other) const noexcept
 {
-    throw not_implemented("bool allocator_sorted_list::sorted_free_iterator::operator==(const allocator_sorted_list::sorted_free_iterator &) const noexcept", "your code should be here...");
+    return _free_ptr == other._free_ptr;
 }
 
 bool allocator_sorted_list::sorted_free_iterator::operator!=(
         const allocator_sorted_list::sorted_free_iterator &other) const noexcept
 {
-    throw not_implemented("bool allocator_sorted_list::sorted_free_iterator::operator!=(const allocator_sorted_list::sorted_free_iterator &) const noexcept", "your code should be here...");
+    return !(*this == other);
 }
 
 allocator_sorted_list::sorted_free_iterator &allocator_sorted_list::sorted_free_iterator::operator++() & noexcept
 {
-    throw not_implemented("allocator_sorted_list::sorted_free_iterator &allocator_sorted_list::sorted_free_iterator::operator++() & noexcept", "your code should be here...");
+    _free_ptr = get_block_pointer(_free_ptr);
+    return *this;
 }
 
 allocator_sorted_list::sorted_free_iterator allocator_sorted_list::sorted_free_iterator::operator++(int n)
 {
-    throw not_implemented("allocator_sorted_list::sorted_free_iterator allocator_sorted_list::sorted_free_iterator::operator++(int)", "your code should be here...");
+    auto copy = *this;
+    ++*this;
+    return copy;
 }
 
 size_t allocator_sorted_list::sorted_free_iterator::size() const noexcept
 {
-    throw not_implemented("size_t allocator_sorted_list::sorted_free_iterator::size() const noexcept", "your code should be here...");
+    return get_block_size(_free_ptr);
 }
 
 void *allocator_sorted_list::sorted_free_iterator::operator*() const noexcept
 {
-    throw not_implemented("void *allocator_sorted_list::sorted_free_iterator::operator*() const noexcept", "your code should be here...");
+    return _free_ptr;
 }
 
 allocator_sorted_list::sorted_free_iterator::sorted_free_iterator()
+        : _free_ptr(nullptr)
 {
-    throw not_implemented("allocator_sorted_list::sorted_free_iterator::sorted_free_iterator()", "your code should be here...");
 }
 
 allocator_sorted_list::sorted_free_iterator::sorted_free_iterator(void *trusted)
+        : _free_ptr(trusted != nullptr ? get_forward(trusted, nullptr, 0) : nullptr)
 {
-    throw not_implemented("allocator_sorted_list::sorted_free_iterator::sorted_free_iterator(void *)", "your code should be here...");
 }
 
 bool allocator_sorted_list::sorted_iterator::operator==(const allocator_sorted_list::sorted_iterator & other) const noexcept
 {
-    throw not_implemented("bool allocator_sorted_list::sorted_iterator::operator==(const allocator_sorted_list::sorted_iterator &) const noexcept", "your code should be here...");
+    return _current_ptr == other._current_ptr;
 }
 
 bool allocator_sorted_list::sorted_iterator::operator!=(const allocator_sorted_list::sorted_iterator &other) const noexcept
 {
-    throw not_implemented("bool allocator_sorted_list::sorted_iterator::operator!=(const allocator_sorted_list::sorted_iterator &) const noexcept", "your code should be here...");
+    return !(*this == other);
 }
 
 allocator_sorted_list::sorted_iterator &allocator_sorted_list::sorted_iterator::operator++() & noexcept
 {
-    throw not_implemented("allocator_sorted_list::sorted_iterator &allocator_sorted_list::sorted_iterator::operator++() & noexcept", "your code should be here...");
+    if (_current_ptr == _free_ptr)
+    {
+        _free_ptr = get_block_pointer(_free_ptr);
+    }
+
+    _current_ptr = static_cast<std::byte*>(_current_ptr) + get_block_size(_current_ptr);
+
+    if (_current_ptr == static_cast<std::byte*>(get_first_block(_trusted_memory)) + get_space_size(_trusted_memory))
+    {
+        _current_ptr = nullptr;
+    }
+
+    return *this;
 }
 
 allocator_sorted_list::sorted_iterator allocator_sorted_list::sorted_iterator::operator++(int n)
 {
-    throw not_implemented("allocator_sorted_list::sorted_iterator allocator_sorted_list::sorted_iterator::operator++(int)", "your code should be here...");
+    auto copy = *this;
+    ++*this;
+    return copy;
 }
 
 size_t allocator_sorted_list::sorted_iterator::size() const noexcept
 {
-    throw not_implemented("size_t allocator_sorted_list::sorted_iterator::size() const noexcept", "your code should be here...");
+    return get_block_size(_current_ptr);
 }
 
 void *allocator_sorted_list::sorted_iterator::operator*() const noexcept
 {
-    throw not_implemented("void *allocator_sorted_list::sorted_iterator::operator*() const noexcept", "your code should be here...");
+    return _current_ptr;
 }
 
 allocator_sorted_list::sorted_iterator::sorted_iterator()
+        : _free_ptr(nullptr), _current_ptr(nullptr), _trusted_memory(nullptr)
 {
-    throw not_implemented("allocator_sorted_list::sorted_iterator::sorted_iterator() ", "your code should be here...");
 }
 
 allocator_sorted_list::sorted_iterator::sorted_iterator(void *trusted)
+        : _free_ptr(trusted != nullptr ? get_forward(trusted, nullptr, 0) : nullptr),
+          _current_ptr(trusted != nullptr ? get_first_block(trusted) : nullptr),
+          _trusted_memory(trusted)
 {
-    throw not_implemented("allocator_sorted_list::sorted_iterator::sorted_iterator(void *)", "your code should be here...");
 }
 
 bool allocator_sorted_list::sorted_iterator::occupied() const noexcept
 {
-    throw not_implemented("bool allocator_sorted_list::sorted_iterator::occupied() const noexcept", "your code should be here...");
+    return _current_ptr != _free_ptr;
 }
@@ -1,4 +1,10 @@
 #include <gtest/gtest.h>
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <tuple>
+#include <vector>
 #include <logger.h>
 #include <logger_builder.h>
 #include <client_logger_builder.h>
@@ -242,6 +248,137 @@ TEST(allocatorSortedListPositiveTests, test5)
     }
 }
 
+TEST(allocatorSortedListPositiveTests, test6)
+{
+    std::unique_ptr<smart_mem_resource> alloc(new allocator_sorted_list(1000, nullptr, nullptr, allocator_with_fit_mode::fit_mode::first_fit));
+    
+    auto first_block = reinterpret_cast<char *>(alloc->allocate(sizeof(char) * 100));
+    auto second_block = reinterpret_cast<char *>(alloc->allocate(sizeof(char) * 100));
+    auto third_block = reinterpret_cast<char *>(alloc->allocate(sizeof(char) * 100));
+    alloc->deallocate(first_block, 1);
+    
+    auto *the_same_subject = dynamic_cast<allocator_with_fit_mode *>(alloc.get());
+    the_same_subject->set_fit_mode(allocator_with_fit_mode::fit_mode::next_fit);
+    auto fourth_block = reinterpret_cast<char *>(alloc->allocate(sizeof(char) * 50));
+    
+    ASSERT_GT(fourth_block, third_block);
+    
+    alloc->deallocate(third_block, 1);
+    alloc->deallocate(second_block, 1);
+    alloc->deallocate(fourth_block, 1);
+    
+    auto actual_blocks_state = dynamic_cast<allocator_test_utils *>(alloc.get())->get_blocks_info();
+    
+    ASSERT_EQ(actual_blocks_state.size(), 1);
+    ASSERT_EQ(actual_blocks_state[0], (allocator_test_utils::block_info{ .block_size = 1000, .is_block_occupied = false }));
+}
+
+TEST(allocatorSortedListPositiveTests, test7)
+{
+    std::unique_ptr<smart_mem_resource> allocator(new allocator_sorted_list(16000, nullptr, nullptr, allocator_with_fit_mode::fit_mode::first_fit));
+    
+    std::vector<std::tuple<void *, size_t, size_t>> blocks;
+    
+    for (size_t alignment = 1; alignment <= 64; alignment <<= 1)
+    {
+        for (size_t size : { 1, 3, 8, 16, 100 })
+        {
+            void *block = allocator->allocate(size, alignment);
+            
+            ASSERT_EQ(reinterpret_cast<std::uintptr_t>(block) % alignment, 0) << "size " << size << ", alignment " << alignment;
+            std::memset(block, 0xAB, size);
+            blocks.emplace_back(block, size, alignment);
+        }
+    }
+    
+    for (auto [block, size, alignment] : blocks)
+    {
+        allocator->deallocate(block, size, alignment);
+    }
+    
+    auto actual_blocks_state = dynamic_cast<allocator_test_utils *>(allocator.get())->get_blocks_info();
+    
+    ASSERT_EQ(actual_blocks_state.size(), 1);
+    ASSERT_EQ(actual_blocks_state[0], (allocator_test_utils::block_info{ .block_size = 16000, .is_block_occupied = false }));
+}
+
+TEST(allocatorSortedListPositiveTests, test8)
+{
+    constexpr size_t blocks_count = 100000;
+    constexpr size_t space_size = blocks_count * 256;
+    
+    for (bool use_skip_index : { true, false })
+    {
+        // without the index every deallocation walks the free list, so fewer fragments are freed
+        const size_t count = use_skip_index ? blocks_count : blocks_count / 50;
+        
+        std::unique_ptr<smart_mem_resource> allocator(new allocator_sorted_list(space_size, nullptr, nullptr, allocator_with_fit_mode::fit_mode::first_fit, use_skip_index));
+        
+        std::vector<void *> blocks(count);
+        for (auto &block : blocks)
+        {
+            block = allocator->allocate(1);
+        }
+        
+        // minimum-size fragments, freed so that none of them is coalesced at first
+        for (size_t i = 0; i < count; i += 2)
+        {
+            allocator->deallocate(blocks[i], 1);
+        }
+        
+        for (size_t i = count; i-- > 0;)
+        {
+            if (i % 2 != 0)
+            {
+                allocator->deallocate(blocks[i], 1);
+            }
+        }
+        
+        auto actual_blocks_state = dynamic_cast<allocator_test_utils *>(allocator.get())->get_blocks_info();
+        
+        ASSERT_EQ(actual_blocks_state.size(), 1);
+        ASSERT_EQ(actual_blocks_state[0], (allocator_test_utils::block_info{ .block_size = space_size, .is_block_occupied = false }));
+    }
+}
+
+TEST(allocatorSortedListPositiveTests, test9)
+{
+    for (bool use_skip_index : { false, true })
+    {
+        std::unique_ptr<smart_mem_resource> allocator(new allocator_sorted_list(4096, nullptr, nullptr, allocator_with_fit_mode::fit_mode::first_fit, use_skip_index));
+        auto *utils = dynamic_cast<allocator_test_utils *>(allocator.get());
+        
+        void *first_block = allocator->allocate(8);
+        void *aligned_block = allocator->allocate(100, 256);
+        
+        ASSERT_EQ(reinterpret_cast<std::uintptr_t>(aligned_block) % 256, 0);
+        
+        // the block is split around the aligned payload instead of taking alignment bytes more,
+        // padding before it is left free
+        auto actual_blocks_state = utils->get_blocks_info();
+        auto aligned_block_info = std::find_if(actual_blocks_state.begin() + 1, actual_blocks_state.end(),
+            [](auto const &block) { return block.is_block_occupied; });
+        
+        ASSERT_NE(aligned_block_info, actual_blocks_state.end());
+        ASSERT_LT(aligned_block_info->block_size, 256);
+        ASSERT_TRUE(aligned_block_info - actual_blocks_state.begin() == 1 || !(aligned_block_info - 1)->is_block_occupied);
+        
+        allocator->deallocate(aligned_block, 100, 256);
+        
+        actual_blocks_state = utils->get_blocks_info();
+        
+        ASSERT_EQ(actual_blocks_state.size(), 2);
+        ASSERT_FALSE(actual_blocks_state[1].is_block_occupied);
+        
+        allocator->deallocate(first_block, 8);
+        
+        actual_blocks_state = utils->get_blocks_info();
+        
+        ASSERT_EQ(actual_blocks_state.size(), 1);
+        ASSERT_EQ(actual_blocks_state[0], (allocator_test_utils::block_info{ .block_size = 4096, .is_block_occupied = false }));
+    }
+}
+
 TEST(allocatorSortedListNegativeTests, test1)
 {
     std::unique_ptr<logger> logger(create_logger(std::vector<std::pair<std::string, logger::severity>>
@@ -256,6 +393,22 @@ TEST(allocatorSortedListNegativeTests, test1)
     ASSERT_THROW(alloc->allocate(sizeof(char) * 3100), std::bad_alloc);
 }
 
+TEST(allocatorSortedListNegativeTests, test2)
+{
+    std::unique_ptr<smart_mem_resource> allocator(new allocator_sorted_list(3000, nullptr, nullptr, allocator_with_fit_mode::fit_mode::first_fit));
+    
+    // size with the block header or the alignment padding would wrap around
+    for (size_t alignment : { 8, 64 })
+    {
+        ASSERT_THROW(static_cast<void>(allocator->allocate(std::numeric_limits<size_t>::max() - 20, alignment)), std::bad_alloc);
+    }
+    
+    auto actual_blocks_state = dynamic_cast<allocator_test_utils *>(allocator.get())->get_blocks_info();
+    
+    ASSERT_EQ(actual_blocks_state.size(), 1);
+    ASSERT_EQ(actual_blocks_state[0], (allocator_test_utils::block_info{ .block_size = 3000, .is_block_occupied = false }));
+}
+
 int main(
     int argc,
     char **argv)
@@ -0,0 +1,181 @@
+#include <benchmark/benchmark.h>
+
+#include <big_int.h>
+#include <random>
+#include <string>
+#include <vector>
+
+/** Sizes are given in limbs (unsigned int digits). Every algorithm sweeps up to its own limit,
+ *  chosen so the largest size takes about a second per iteration or less in a release build.
+ *  Restrict the run with --benchmark_filter, e.g. --benchmark_filter=Karatsuba
+ */
+namespace
+{
+    constexpr int64_t MIN_LIMBS = 1;
+    constexpr int64_t QUADRATIC_MULTIPLICATION_MAX_LIMBS = 1 << 12;
+    constexpr int64_t FAST_MULTIPLICATION_MAX_LIMBS = 1 << 15;
+    constexpr int64_t DIVISION_MAX_LIMBS = 1 << 9;
+    constexpr int64_t TO_STRING_MAX_LIMBS = 1 << 6;
+    constexpr int64_t PARSING_MAX_LIMBS = 1 << 9;
+    constexpr int64_t GCD_MAX_LIMBS = 1 << 5;
+    constexpr int RANGE_MULTIPLIER = 8;
+
+    big_int random_big_int(size_t limbs, std::mt19937 &engine)
+    {
+        std::uniform_int_distribution<unsigned int> distribution;
+        std::vector<unsigned int> digits(limbs);
+
+        for (auto &digit : digits)
+        {
+            digit = distribution(engine);
+        }
+        digits.back() |= 1u << (std::numeric_limits<unsigned int>::digits - 1);
+
+        return big_int(digits);
+    }
+
+    template<big_int::multiplication_rule rule>
+    void multiplication(benchmark::State &state)
+    {
+        std::mt19937 engine(42);
+        const auto limbs = static_cast<size_t>(state.range(0));
+        const big_int lhs = random_big_int(limbs, engine);
+        const big_int rhs = random_big_int(limbs, engine);
+
+        for (auto _ : state)
+        {
+            big_int result(lhs);
+            result.multiply_assign(rhs, rule);
+            benchmark::DoNotOptimize(result);
+        }
+
+        state.SetComplexityN(state.range(0));
+    }
+
+    template<big_int::division_rule rule>
+    void division(benchmark::State &state)
+    {
+        std::mt19937 engine(42);
+        const auto limbs = static_cast<size_t>(state.range(0));
+        const big_int dividend = random_big_int(2 * limbs, engine);
+        const big_int divisor = random_big_int(limbs, engine);
+
+        for (auto _ : state)
+        {
+            big_int result(dividend);
+            result.divide_assign(divisor, rule);
+            benchmark::DoNotOptimize(result);
+        }
+
+        state.SetComplexityN(state.range(0));
+    }
+
+    template<big_int::division_rule rule>
+    void modulo(benchmark::State &state)
+    {
+        std::mt19937 engine(42);
+        const auto limbs = static_cast<size_t>(state.range(0));
+        const big_int dividend = random_big_int(2 * limbs, engine);
+        const big_int divisor = random_big_int(limbs, engine);
+
+        for (auto _ : state)
+        {
+            big_int result(dividend);
+            result.modulo_assign(divisor, rule);
+            benchmark::DoNotOptimize(result);
+        }
+
+        state.SetComplexityN(state.range(0));
+    }
+
+    void to_string(benchmark::State &state)
+    {
+        std::mt19937 engine(42);
+        const big_int value = random_big_int(static_cast<size_t>(state.range(0)), engine);
+
+        for (auto _ : state)
+        {
+            benchmark::DoNotOptimize(value.to_string());
+        }
+
+        state.SetComplexityN(state.range(0));
+    }
+
+    void parsing(benchmark::State &state)
+    {
+        std::mt19937 engine(42);
+        const std::string value = random_big_int(static_cast<size_t>(state.range(0)), engine).to_string();
+
+        for (auto _ : state)
+        {
+            benchmark::DoNotOptimize(big_int(value));
+        }
+
+        state.SetComplexityN(state.range(0));
+        state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * value.size()));
+    }
+
+    void greatest_common_divisor(benchmark::State &state)
+    {
+        std::mt19937 engine(42);
+        const auto limbs = static_cast<size_t>(state.range(0));
+        const big_int lhs = random_big_int(limbs, engine);
+        const big_int rhs = random_big_int(limbs, engine);
+
+        for (auto _ : state)
+        {
+            benchmark::DoNotOptimize(gcd(lhs, rhs));
+        }
+
+        state.SetComplexityN(state.range(0));
+    }
+
+    template<int64_t max_limbs>
+    void sweep(benchmark::internal::Benchmark *benchmark)
+    {
+        benchmark->RangeMultiplier(RANGE_MULTIPLIER)
+                ->Range(MIN_LIMBS, max_limbs)
+                ->Unit(benchmark::kMicrosecond)
+                ->Complexity();
+    }
+}
+
+BENCHMARK(multiplication<big_int::multiplication_rule::trivial>)->Apply(sweep<QUADRATIC_MULTIPLICATION_MAX_LIMBS>);
+BENCHMARK(multiplication<big_int::multiplication_rule::Karatsuba>)->Apply(sweep<FAST_MULTIPLICATION_MAX_LIMBS>);
+BENCHMARK(multiplication<big_int::multiplication_rule::SchonhageStrassen>)->Apply(sweep<FAST_MULTIPLICATION_MAX_LIMBS>);
+
+BENCHMARK(division<big_int::division_rule::trivial>)->Apply(sweep<DIVISION_MAX_LIMBS>);
+BENCHMARK(division<big_int::division_rule::Newton>)->Apply(sweep<DIVISION_MAX_LIMBS>);
+BENCHMARK(division<big_int::division_rule::BurnikelZiegler>)->Apply(sweep<DIVISION_MAX_LIMBS>);
+
+BENCHMARK(modulo<big_int::division_rule::trivial>)->Apply(sweep<DIVISION_MAX_LIMBS>);
+BENCHMARK(modulo<big_int::division_rule::Newton>)->Apply(sweep<DIVISION_MAX_LIMBS>);
+BENCHMARK(modulo<big_int::division_rule::BurnikelZiegler>)->Apply(sweep<DIVISION_MAX_LIMBS>);
+
+BENCHMARK(to_string)->Apply(sweep<TO_STRING_MAX_LIMBS>);
+BENCHMARK(parsing)->Apply(sweep<PARSING_MAX_LIMBS>);
+BENCHMARK(greatest_common_divisor)->Apply(sweep<GCD_MAX_LIMBS>);
+
+/** JSON is the default console format so results can be diffed between releases,
+ *  any explicit --benchmark_format argument overrides it
+ */
+int main(
+    int argc,
+    char **argv)
+{
+    std::vector<char *> arguments(argv, argv + argc);
+    std::string json_format = "--benchmark_format=json";
+    arguments.insert(arguments.begin() + 1, json_format.data());
+    int arguments_count = static_cast<int>(arguments.size());
+
+    benchmark::Initialize(&arguments_count, arguments.data());
+    if (benchmark::ReportUnrecognizedArguments(arguments_count, arguments.data()))
+    {
+        return 1;
+    }
+
+    benchmark::RunSpecifiedBenchmarks();
+    benchmark::Shutdown();
+
+    return 0;
+}
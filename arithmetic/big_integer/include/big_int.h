@@ -151,6 +151,41 @@ public:
     bool operator>(const big_int& other) const noexcept;
     bool operator>=(const big_int& other) const noexcept;
 
+    /** Compares absolute values, signs of both operands are ignored
+     *  @example shift = 1: |this| <=> |other| * 2^32
+     */
+    std::strong_ordering cmp_abs(const big_int& other, size_t shift = 0) const noexcept;
+
+    bool is_zero() const noexcept;
+    bool is_one() const noexcept;
+    bool is_negative() const noexcept;
+
+    /** Remainder of |*this| by a machine word, computed limb by limb without temporaries
+     */
+    unsigned long long mod_word(unsigned long long modulus) const noexcept;
+
+    /** Divides |*this| by a single limb in place, sign is kept
+     *  @return remainder of |*this| by divisor
+     */
+    unsigned int divide_word(unsigned int divisor) &;
+
+    /** Number of significant bits of |*this|, 0 for zero
+     */
+    size_t bit_length() const noexcept;
+
+    /** Number of trailing zero bits of |*this|, 0 for zero
+     */
+    size_t trailing_zero_bits() const noexcept;
+
+    /** |*this| ~ mantissa * 2^exponent, mantissa in [0.5, 1) is rounded from leading limbs,
+     *  so exponent is bit_length() or one more if rounding carried. {0, 0} for zero
+     */
+    std::pair<double, size_t> frexp() const noexcept;
+
+    /** Limbs of |*this|, least significant first, without leading zeros
+     */
+    std::vector<unsigned int, pp_allocator<unsigned int>> const &digits() const noexcept;
+
 
     big_int& operator<<=(size_t shift) &;
 
@@ -160,6 +195,12 @@ public:
     big_int operator<<(size_t shift) const;
     big_int operator>>(size_t shift) const;
 
+    /** Writes shifted value into destination without copying *this first
+     *  @return destination
+     */
+    big_int& shift_left_to(big_int& destination, size_t shift) const;
+    big_int& shift_right_to(big_int& destination, size_t shift) const;
+
     big_int operator~() const;
 
     big_int& operator&=(const big_int& other) &;
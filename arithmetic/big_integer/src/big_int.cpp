@@ -5,9 +5,14 @@
 #include <sstream>
 #include <cmath>
 #include <algorithm>
+#include <bit>
 
 constexpr unsigned long long BASE = std::numeric_limits<unsigned int>::max();
 
+/** Operands shorter than this in limbs are multiplied by schoolbook inside Karatsuba recursion
+ */
+constexpr size_t KARATSUBA_THRESHOLD = 32;
+
 big_int &big_int::optimize() &
 {
     while (!_digits.empty() && _digits.back() == 0) _digits.pop_back();
@@ -109,27 +114,21 @@ big_int& big_int::plus_assign(const big_int& other, size_t shift) &
         }
 
     } else {
-        big_int abs_other(other);
-        abs_other._sign = true;
-        big_int abs_this(*this);
-        abs_this._sign = true;
-
-        for (size_t i = 0; i < shift; ++i) {
-            abs_other._digits.emplace(abs_other._digits.begin(), 0u);
-        }
-
-        auto comp = abs_this <=> abs_other;
+        auto comp = cmp_abs(other, shift);
 
         if (comp == std::strong_ordering::less) {
-            for (size_t offset = 0; offset < _digits.size(); ++offset) {
-                abs_other.decrease_module(_digits[offset], offset);
+            std::vector<unsigned int, pp_allocator<unsigned int>> subtrahend(shift, 0u, _digits.get_allocator());
+            subtrahend.insert(subtrahend.end(), other._digits.begin(), other._digits.end());
+            std::swap(_digits, subtrahend);
+
+            for (size_t offset = 0; offset < subtrahend.size(); ++offset) {
+                decrease_module(subtrahend[offset], offset);
             }
-            _digits = std::move(abs_other._digits);
             _sign = !_sign;
 
         } else if (comp == std::strong_ordering::greater) {
             for (size_t offset = 0; offset < other._digits.size(); ++offset) {
-                decrease_module(abs_other._digits[offset], offset);
+                decrease_module(other._digits[offset], shift + offset);
             }
 
         } else {
@@ -148,27 +147,21 @@ big_int &big_int::minus_assign(const big_int &other, size_t shift) &
         }
 
     } else {
-        big_int abs_other(other);
-        abs_other._sign = true;
-        big_int abs_this(*this);
-        abs_this._sign = true;
-
-        for (size_t i = 0; i < shift; ++i) {
-            abs_other._digits.emplace(abs_other._digits.begin(), 0u);
-        }
-
-        auto comp = abs_this <=> abs_other;
+        auto comp = cmp_abs(other, shift);
 
         if (comp == std::strong_ordering::less) {
-            for (size_t offset = 0; offset < _digits.size(); ++offset) {
-                abs_other.decrease_module(_digits[offset], offset);
+            std::vector<unsigned int, pp_allocator<unsigned int>> subtrahend(shift, 0u, _digits.get_allocator());
+            subtrahend.insert(subtrahend.end(), other._digits.begin(), other._digits.end());
+            std::swap(_digits, subtrahend);
+
+            for (size_t offset = 0; offset < subtrahend.size(); ++offset) {
+                decrease_module(subtrahend[offset], offset);
             }
-            _digits = std::move(abs_other._digits);
             _sign = !_sign;
 
         } else if (comp == std::strong_ordering::greater) {
             for (size_t offset = 0; offset < other._digits.size(); ++offset) {
-                decrease_module(abs_other._digits[offset], offset);
+                decrease_module(other._digits[offset], shift + offset);
             }
 
         } else {
@@ -247,6 +240,10 @@ big_int::big_int(pp_allocator<unsigned int> allocator)
 
 std::strong_ordering big_int::operator<=>(const big_int& other) const noexcept
 {
+    if (_digits.empty() && other._digits.empty()) {
+        return std::strong_ordering::equal;
+    }
+
     if (_sign != other._sign) {
         return _sign ? std::strong_ordering::greater : std::strong_ordering::less;
     }
@@ -284,6 +281,125 @@ std::strong_ordering big_int::operator<=>(const big_int& other) const noexcept
     return std::strong_ordering::equal;
 }
 
+std::strong_ordering big_int::cmp_abs(const big_int &other, size_t shift) const noexcept
+{
+    const size_t other_size = other._digits.empty() ? 0 : other._digits.size() + shift;
+
+    if (_digits.size() != other_size) {
+        return _digits.size() <=> other_size;
+    }
+
+    for (size_t i = _digits.size(); i > shift; --i) {
+        if (_digits[i - 1] != other._digits[i - 1 - shift]) {
+            return _digits[i - 1] <=> other._digits[i - 1 - shift];
+        }
+    }
+
+    for (size_t i = 0; i < shift && i < _digits.size(); ++i) {
+        if (_digits[i] != 0) {
+            return std::strong_ordering::greater;
+        }
+    }
+
+    return std::strong_ordering::equal;
+}
+
+bool big_int::is_zero() const noexcept
+{
+    return _digits.empty();
+}
+
+bool big_int::is_one() const noexcept
+{
+    return _sign && _digits.size() == 1 && _digits[0] == 1;
+}
+
+bool big_int::is_negative() const noexcept
+{
+    return !_sign && !_digits.empty();
+}
+
+unsigned long long big_int::mod_word(unsigned long long modulus) const noexcept
+{
+    constexpr size_t UINT_BITS = std::numeric_limits<unsigned int>::digits;
+    unsigned __int128 remainder = 0;
+
+    for (auto it = _digits.rbegin(); it != _digits.rend(); ++it) {
+        remainder = ((remainder << UINT_BITS) | *it) % modulus;
+    }
+
+    return static_cast<unsigned long long>(remainder);
+}
+
+unsigned int big_int::divide_word(unsigned int divisor) &
+{
+    if (divisor == 0)
+    {
+        throw std::logic_error("Division by zero");
+    }
+
+    constexpr size_t UINT_BITS = std::numeric_limits<unsigned int>::digits;
+    unsigned long long remainder = 0;
+
+    for (auto it = _digits.rbegin(); it != _digits.rend(); ++it) {
+        unsigned long long current = (remainder << UINT_BITS) | *it;
+        *it = static_cast<unsigned int>(current / divisor);
+        remainder = current % divisor;
+    }
+
+    optimize();
+    return static_cast<unsigned int>(remainder);
+}
+
+size_t big_int::bit_length() const noexcept
+{
+    if (_digits.empty()) {
+        return 0;
+    }
+
+    constexpr size_t UINT_BITS = std::numeric_limits<unsigned int>::digits;
+    return (_digits.size() - 1) * UINT_BITS + std::bit_width(_digits.back());
+}
+
+size_t big_int::trailing_zero_bits() const noexcept
+{
+    constexpr size_t UINT_BITS = std::numeric_limits<unsigned int>::digits;
+
+    for (size_t i = 0; i < _digits.size(); ++i) {
+        if (_digits[i] != 0) {
+            return i * UINT_BITS + std::countr_zero(_digits[i]);
+        }
+    }
+
+    return 0;
+}
+
+std::vector<unsigned int, pp_allocator<unsigned int>> const &big_int::digits() const noexcept
+{
+    return _digits;
+}
+
+std::pair<double, size_t> big_int::frexp() const noexcept
+{
+    if (_digits.empty()) {
+        return {0.0, 0};
+    }
+
+    constexpr size_t UINT_BITS = std::numeric_limits<unsigned int>::digits;
+    constexpr size_t LEADING_LIMBS = 3;
+    const size_t taken = std::min(LEADING_LIMBS, _digits.size());
+
+    double leading = 0.0;
+    for (size_t i = 1; i <= taken; ++i) {
+        leading = std::ldexp(leading, UINT_BITS) + _digits[_digits.size() - i];
+    }
+
+    int exponent = 0;
+    double mantissa = std::frexp(leading, &exponent);
+
+    return {mantissa, (_digits.size() - taken) * UINT_BITS + static_cast<size_t>(exponent)};
+}
+
 bool big_int::operator==(const big_int& other) const noexcept
 {
     return (*this <=> other) == std::strong_ordering::equal;
@@ -414,18 +530,89 @@ big_int big_int::operator^(const big_int &other) const
 
 big_int big_int::operator<<(size_t shift) const
 {
-    big_int _new(*this);
-    _new <<= shift;
+    big_int _new(_digits.get_allocator());
+    shift_left_to(_new, shift);
     return _new;
 }
 
 big_int big_int::operator>>(size_t shift) const
 {
-    big_int _new(*this);
-    _new >>= shift;
+    big_int _new(_digits.get_allocator());
+    shift_right_to(_new, shift);
     return _new;
 }
 
+big_int &big_int::shift_left_to(big_int &destination, size_t shift) const
+{
+    if (&destination == this) {
+        return destination <<= shift;
+    }
+
+    constexpr size_t UINT_BITS = std::numeric_limits<unsigned int>::digits;
+    const size_t element_shift = shift / UINT_BITS;
+    const size_t bit_shift = shift % UINT_BITS;
+
+    destination._sign = _sign;
+    destination._digits.clear();
+
+    if (_digits.empty()) {
+        return destination.optimize();
+    }
+
+    destination._digits.reserve(_digits.size() + element_shift + 1);
+    destination._digits.resize(element_shift, 0u);
+
+    if (bit_shift == 0) {
+        destination._digits.insert(destination._digits.end(), _digits.begin(), _digits.end());
+        return destination;
+    }
+
+    unsigned int carry = 0;
+
+    for (unsigned int digit : _digits) {
+        destination._digits.push_back((digit << bit_shift) | carry);
+        carry = digit >> (UINT_BITS - bit_shift);
+    }
+
+    if (carry != 0) {
+        destination._digits.push_back(carry);
+    }
+
+    return destination;
+}
+
+big_int &big_int::shift_right_to(big_int &destination, size_t shift) const
+{
+    if (&destination == this) {
+        return destination >>= shift;
+    }
+
+    constexpr size_t UINT_BITS = std::numeric_limits<unsigned int>::digits;
+    const size_t element_shift = shift / UINT_BITS;
+    const size_t bit_shift = shift % UINT_BITS;
+
+    destination._sign = _sign;
+    destination._digits.clear();
+
+    if (element_shift >= _digits.size()) {
+        return destination.optimize();
+    }
+
+    destination._digits.reserve(_digits.size() - element_shift);
+
+    if (bit_shift == 0) {
+        destination._digits.insert(destination._digits.end(), _digits.begin() + static_cast<long long>(element_shift), _digits.end());
+        return destination.optimize();
+    }
+
+    for (size_t i = element_shift; i < _digits.size(); ++i) {
+        unsigned int high = i + 1 < _digits.size() ? _digits[i + 1] << (UINT_BITS - bit_shift) : 0u;
+        destination._digits.push_back((_digits[i] >> bit_shift) | high);
+    }
+
+    return destination.optimize();
+}
+
 big_int &big_int::operator%=(const big_int &other) &
 {
     return modulo_assign(other);
@@ -575,7 +762,7 @@ big_int &big_int::operator/=(const big_int &other) &
 big_int big_int::operator -() const
 {
     big_int _new(*this);
-    _new._sign = !_sign;
+    _new._sign = !_sign || _digits.empty();
     return _new;
 }
 
@@ -591,7 +778,7 @@ std::string big_int::to_string() const
 
     tmp._sign = true;
 
-    while (tmp > 0_bi)
+    while (!tmp.is_zero())
     {
         auto val = tmp % 10_bi;
         tmp /= 10_bi;
@@ -640,20 +827,29 @@ big_int &big_int::multiply_assign(const big_int &other, big_int::multiplication_
 
 big_int &big_int::trivial_multiply(const big_int &other) &
 {
-    _sign = !(_sign ^ other._sign);
-    big_int tmp(*this);
-    big_int tmp_other(other);
-    big_int accumulator(0);
+    // schoolbook on limbs, every partial product fits in 64 bits together with the carry
+    constexpr size_t UINT_BITS = std::numeric_limits<unsigned int>::digits;
+
+    std::vector<unsigned int, pp_allocator<unsigned int>> result(
+            _digits.size() + other._digits.size(), 0u, _digits.get_allocator());
+
+    for (size_t i = 0; i < _digits.size(); ++i)
+    {
+        unsigned long long carry = 0;
+        const unsigned long long digit = _digits[i];
 
-    while (tmp_other) {
-        if (tmp_other._digits[0] & 1u) {
-            accumulator += tmp;
+        for (size_t j = 0; j < other._digits.size(); ++j)
+        {
+            carry += digit * other._digits[j] + result[i + j];
+            result[i + j] = static_cast<unsigned int>(carry);
+            carry >>= UINT_BITS;
         }
-        tmp <<= 1;
-        tmp_other >>= 1;
+
+        result[i + other._digits.size()] = static_cast<unsigned int>(carry);
     }
 
-    _digits = std::move(accumulator._digits);
+    _sign = !(_sign ^ other._sign);
+    _digits = std::move(result);
     optimize();
     return *this;
 }
@@ -679,12 +875,7 @@ big_int &big_int::divide_assign(const big_int &other, big_int::division_rule rul
 
 big_int &big_int::trivial_division(const big_int &other) &
 {
-    big_int abs_this(*this);
-    abs_this._sign = true;
-    big_int abs_other(other);
-    abs_other._sign = true;
-
-    if (abs_this < abs_other)
+    if (cmp_abs(other) == std::strong_ordering::less)
     {
         _digits.clear();
         _sign = true;
@@ -706,10 +897,10 @@ big_int &big_int::trivial_division(const big_int &other) &
         unsigned int &closest = digit._digits[0];
         for (int j = std::numeric_limits<unsigned int>::digits - 1; j >= 0; --j) {
             const unsigned int temp = closest;
-            closest |= 1 << j;
-            big_int multiplied = abs_other * digit;
+            closest |= 1u << j;
+            big_int multiplied = other * digit;
 
-            auto comp = multiplied <=> remainder;
+            auto comp = multiplied.cmp_abs(remainder);
             if (comp == std::strong_ordering::equal) {
                 break;
             } else if (comp == std::strong_ordering::less) {
@@ -721,7 +912,8 @@ big_int &big_int::trivial_division(const big_int &other) &
 
         quotient.insert(quotient.begin(), digit._digits[0]);
 
-        big_int prod = abs_other * digit;
+        big_int prod = other * digit;
+        prod._sign = true;
         remainder -= prod;
         remainder.optimize();
     }
@@ -754,12 +946,7 @@ big_int &big_int::modulo_assign(const big_int &other, big_int::division_rule rul
 
 big_int &big_int::trivial_modulo(const big_int &other) &
 {
-    big_int abs_this(*this);
-    abs_this._sign = true;
-    big_int abs_other(other);
-    abs_other._sign = true;
-
-    if (abs_this < abs_other)
+    if (cmp_abs(other) == std::strong_ordering::less)
     {
         return *this;
     }
@@ -778,10 +965,10 @@ big_int &big_int::trivial_modulo(const big_int &other) &
         unsigned int &closest = digit._digits[0];
         for (int j = std::numeric_limits<unsigned int>::digits - 1; j >= 0; --j) {
             const unsigned int temp = closest;
-            closest |= 1 << j;
-            big_int multiplied = abs_other * digit;
+            closest |= 1u << j;
+            big_int multiplied = other * digit;
 
-            auto comp = multiplied <=> remainder;
+            auto comp = multiplied.cmp_abs(remainder);
             if (comp == std::strong_ordering::equal) {
                 break;
             } else if (comp == std::strong_ordering::less) {
@@ -791,7 +978,8 @@ big_int &big_int::trivial_modulo(const big_int &other) &
             }
         }
 
-        big_int prod = abs_other * digit;
+        big_int prod = other * digit;
+        prod._sign = true;
         remainder -= prod;
         remainder.optimize();
     }
@@ -810,17 +998,20 @@ big_int operator""_bi(unsigned long long n)
 
 big_int gcd(const big_int &a, const big_int &b)
 {
-    if (!b) {
-        return a > 0_bi ? a : -a;
-    } else {
-        big_int c = ((a % b) + b) % b;
-        return gcd(b, c);
+    big_int x = a.is_negative() ? -a : a;
+    big_int y = b.is_negative() ? -b : b;
+
+    while (!y.is_zero()) {
+        x %= y;
+        std::swap(x, y);
     }
+
+    return x;
 }
 
 big_int &big_int::karatsuba(const big_int &other) &
 {
-    if (this->_digits.size() < 3 || other._digits.size() < 3)
+    if (this->_digits.size() < KARATSUBA_THRESHOLD || other._digits.size() < KARATSUBA_THRESHOLD)
     {
         return trivial_multiply(other);
     }
@@ -848,6 +1039,8 @@ big_int &big_int::karatsuba(const big_int &other) &
     big_int second = this_left + this_right;
     big_int tmp = other_left + other_right;
     second.karatsuba(tmp);
+    second -= first;
+    second -= third;
 
     first <<= 2 * x_pow;
     second <<= x_pow;
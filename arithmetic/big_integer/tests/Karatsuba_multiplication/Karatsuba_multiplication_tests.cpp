@@ -165,6 +165,25 @@ TEST(positive_tests_kar, test7)
     delete logger;
 }
 
+TEST(positive_tests_kar, test8)
+{
+    logger *logger = create_logger(std::vector<std::pair<std::string, logger::severity>>
+                                       {
+                                           {
+                                               "bigint_logs.txt",
+                                               logger::severity::information
+                                           },
+                                       });
+
+    big_int bigint_1("7924796707963160176636780674791");
+    big_int bigint_2("-957304069945956794936328192000000");
+    bigint_1.multiply_assign(bigint_2, big_int::multiplication_rule::Karatsuba);
+
+    EXPECT_TRUE((std::ostringstream() << bigint_1).str() == "-7586440142027453233579944719372490544982168469981597007872000000");
+
+    delete logger;
+}
+
 int main(
     int argc,
     char **argv)
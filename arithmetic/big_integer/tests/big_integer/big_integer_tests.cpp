@@ -231,6 +231,78 @@ TEST(positive_tests, test9)
     delete logger;
 }
 
+TEST(positive_tests, test10)
+{
+    logger *logger = create_logger(std::vector<std::pair<std::string, logger::severity>>
+        {
+            {
+                "bigint_logs.txt",
+                logger::severity::information
+            },
+        });
+
+    big_int bigint_1("-4238954354324222222222234");
+    big_int bigint_2("4238954354324222222222234");
+    big_int bigint_3("-4238954354324222200000000");
+
+    EXPECT_TRUE(bigint_1.cmp_abs(bigint_2) == std::strong_ordering::equal);
+    EXPECT_TRUE(bigint_3.cmp_abs(bigint_2) == std::strong_ordering::less);
+    EXPECT_TRUE(bigint_1.cmp_abs(bigint_3) == std::strong_ordering::greater);
+    EXPECT_TRUE((bigint_2 << 32).cmp_abs(bigint_1, 1) == std::strong_ordering::equal);
+    EXPECT_TRUE(big_int("0").is_zero());
+    EXPECT_TRUE(big_int("1").is_one());
+    EXPECT_FALSE(big_int("-1").is_one());
+    EXPECT_TRUE(bigint_1.is_negative());
+
+    delete logger;
+}
+
+TEST(positive_tests, test11)
+{
+    logger *logger = create_logger(std::vector<std::pair<std::string, logger::severity>>
+        {
+            {
+                "bigint_logs.txt",
+                logger::severity::information
+            },
+        });
+
+    big_int bigint_1("-32850346459076457453464575686784654");
+    big_int shifted;
+
+    bigint_1.shift_left_to(shifted, 77);
+    EXPECT_EQ(shifted.to_string(), "-4964204002207942205437803832273434665608545100510829477888");
+
+    big_int restored;
+    shifted.shift_right_to(restored, 77);
+    EXPECT_TRUE(restored == bigint_1);
+
+    EXPECT_TRUE((bigint_1 >> 200).is_zero());
+
+    delete logger;
+}
+
+TEST(positive_tests, test12)
+{
+    logger *logger = create_logger(std::vector<std::pair<std::string, logger::severity>>
+        {
+            {
+                "bigint_logs.txt",
+                logger::severity::information
+            },
+        });
+
+    big_int zero("0");
+    big_int negated = -zero;
+
+    EXPECT_TRUE(negated == zero);
+    EXPECT_FALSE(negated < zero);
+    EXPECT_FALSE(negated.is_negative());
+    EXPECT_TRUE(big_int("-5") < negated);
+
+    delete logger;
+}
+
 int main(
     int argc,
     char **argv)
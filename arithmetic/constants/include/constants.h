@@ -0,0 +1,84 @@
+#ifndef MP_OS_CONSTANTS_H
+#define MP_OS_CONSTANTS_H
+
+#include <map>
+#include <cstdint>
+#include <mutex>
+#include <optional>
+#include <filesystem>
+#include <big_int.h>
+
+/** Service computing mathematical constants as fixed-point big_int values.
+ *  Every constant is cached with the greatest precision computed so far, requests
+ *  for fewer bits truncate it. With storage path given, cache is loaded on construction
+ *  and written back after every extension, so restarts do not recompute constants.
+ */
+class constants final
+{
+
+public:
+
+    enum class constant : uint32_t
+    {
+        pi = 0,
+        e = 1
+    };
+
+private:
+
+    /** value * 2^bits rounded down
+     */
+    struct entry
+    {
+        size_t bits = 0;
+        big_int value;
+    };
+
+    std::optional<std::filesystem::path> _storage;
+    std::map<constant, entry> _cache;
+    mutable std::mutex _mutex;
+
+public:
+
+    explicit constants(std::optional<std::filesystem::path> storage = std::nullopt);
+
+public:
+
+    /** pi * 2^bits rounded down, Chudnovsky series summed by binary splitting
+     */
+    big_int pi(size_t bits);
+
+    /** e * 2^bits rounded down, sum of 1 / n! summed by binary splitting
+     */
+    big_int e(size_t bits);
+
+    /** value * 2^bits rounded down
+     */
+    big_int get(constant which, size_t bits);
+
+    /** value * 10^digits rounded down
+     */
+    big_int decimal(constant which, size_t digits);
+
+    /** Greatest precision in bits cached for constant, 0 if none
+     */
+    size_t cached_bits(constant which) const;
+
+public:
+
+    /** Writes cache to storage, does nothing if storage path is not set.
+     *  File is replaced atomically through a temporary neighbour
+     */
+    void save() const;
+
+private:
+
+    void load();
+
+    void write_storage() const;
+
+    static big_int compute(constant which, size_t bits);
+
+};
+
+#endif //MP_OS_CONSTANTS_H
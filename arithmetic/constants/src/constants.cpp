@@ -0,0 +1,261 @@
+#include "../include/constants.h"
+#include <hypergeometric_series.h>
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+#include <stdexcept>
+
+namespace
+{
+    /** Computed values are shifted down by guard bits, so truncation of series tail
+     *  and of square root does not reach the last requested bit in practice
+     */
+    constexpr size_t GUARD_BITS = 32;
+
+    constexpr char STORAGE_MAGIC[8] = {'M', 'P', 'C', 'N', 'S', 'T', '0', '1'};
+
+    constexpr unsigned long long CHUDNOVSKY_A = 13591409;
+    constexpr unsigned long long CHUDNOVSKY_B = 545140134;
+    // 640320^3 / 24
+    constexpr unsigned long long CHUDNOVSKY_C3_OVER_24 = 10939058860032000ull;
+
+    /** floor(sqrt(value)): root of the upper half is refined by one Newton step,
+     *  so every division works with twice as many bits as the previous one
+     */
+    big_int integer_sqrt(big_int const &value)
+    {
+        constexpr size_t DOUBLE_EXACT_BITS = 52;
+
+        big_int root;
+        if (value.bit_length() <= DOUBLE_EXACT_BITS) {
+            root = big_int(static_cast<unsigned long long>(
+                    std::sqrt(static_cast<double>(value.mod_word(1ull << DOUBLE_EXACT_BITS)))));
+        } else {
+            size_t shift = value.bit_length() / 4;
+            root = integer_sqrt(value >> (2 * shift)) << shift;
+            root += value / root;
+            root >>= 1;
+        }
+
+        while (root * root > value) {
+            --root;
+        }
+        while ((root + 1_bi) * (root + 1_bi) <= value) {
+            ++root;
+        }
+
+        return root;
+    }
+
+    template<typename T>
+    void write_value(std::ostream &stream, T value)
+    {
+        stream.write(reinterpret_cast<const char *>(&value), sizeof(T));
+    }
+
+    template<typename T>
+    bool read_value(std::istream &stream, T &value)
+    {
+        return static_cast<bool>(stream.read(reinterpret_cast<char *>(&value), sizeof(T)));
+    }
+}
+
+constants::constants(std::optional<std::filesystem::path> storage)
+        : _storage(std::move(storage))
+{
+    load();
+}
+
+big_int constants::pi(size_t bits)
+{
+    return get(constant::pi, bits);
+}
+
+big_int constants::e(size_t bits)
+{
+    return get(constant::e, bits);
+}
+
+big_int constants::get(constant which, size_t bits)
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+
+    entry &cached = _cache[which];
+    if (cached.bits < bits) {
+        size_t extended = std::max(bits, cached.bits + cached.bits / 2);
+        cached.value = compute(which, extended);
+        cached.bits = extended;
+        write_storage();
+    }
+
+    return cached.value >> (cached.bits - bits);
+}
+
+big_int constants::decimal(constant which, size_t digits)
+{
+    size_t bits = static_cast<size_t>(std::ceil(static_cast<double>(digits) * std::log2(10.0))) + GUARD_BITS;
+
+    big_int power = 1_bi;
+    big_int base = 10_bi;
+    for (size_t degree = digits; degree > 0; degree >>= 1) {
+        if (degree & 1) {
+            power.multiply_assign(base, big_int::multiplication_rule::Karatsuba);
+        }
+        if (degree > 1) {
+            big_int square = base;
+            base.multiply_assign(square, big_int::multiplication_rule::Karatsuba);
+        }
+    }
+
+    big_int value = get(which, bits);
+    value.multiply_assign(power, big_int::multiplication_rule::Karatsuba);
+
+    return value >> bits;
+}
+
+size_t constants::cached_bits(constant which) const
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+
+    auto it = _cache.find(which);
+    return it == _cache.end() ? 0 : it->second.bits;
+}
+
+big_int constants::compute(constant which, size_t bits)
+{
+    const size_t guarded = bits + GUARD_BITS;
+
+    switch (which) {
+        case constant::pi: {
+            // 1 / pi = 12 / 640320^(3/2) * sum (-1)^n (6n)! / ((3n)! (n!)^3) * (A + B n) / 640320^(3n),
+            // so pi = 426880 * sqrt(10005) * Q / T
+            hypergeometric_series series(
+                    [](size_t n) {
+                        if (n == 0) {
+                            return 1_bi;
+                        }
+                        auto k = static_cast<unsigned long long>(n);
+                        return -(big_int(6 * k - 5) * big_int(2 * k - 1) * big_int(6 * k - 1));
+                    },
+                    [](size_t n) {
+                        if (n == 0) {
+                            return 1_bi;
+                        }
+                        big_int k(static_cast<unsigned long long>(n));
+                        return k * k * k * big_int(CHUDNOVSKY_C3_OVER_24);
+                    },
+                    [](size_t n) { return big_int(CHUDNOVSKY_A + CHUDNOVSKY_B * static_cast<unsigned long long>(n)); });
+
+            auto sum = series.split(0, series.terms_count(guarded));
+            big_int numerator = integer_sqrt(10005_bi << (2 * guarded));
+            numerator.multiply_assign(sum.Q, big_int::multiplication_rule::Karatsuba);
+            numerator.multiply_assign(426880_bi, big_int::multiplication_rule::Karatsuba);
+
+            return (numerator / sum.T) >> GUARD_BITS;
+        }
+        case constant::e: {
+            hypergeometric_series series(
+                    [](size_t) { return 1_bi; },
+                    [](size_t n) { return n == 0 ? 1_bi : big_int(static_cast<unsigned long long>(n)); });
+
+            auto sum = series.split(0, series.terms_count(guarded));
+            return (sum.T << bits) / sum.Q;
+        }
+    }
+
+    throw std::invalid_argument("Unknown constant");
+}
+
+void constants::save() const
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    write_storage();
+}
+
+void constants::write_storage() const
+{
+    if (!_storage) {
+        return;
+    }
+
+    std::filesystem::path temporary = *_storage;
+    temporary += ".tmp";
+
+    {
+        std::ofstream stream(temporary, std::ios::binary | std::ios::trunc);
+        if (!stream) {
+            throw std::runtime_error("Cannot open constants storage " + temporary.string());
+        }
+
+        stream.write(STORAGE_MAGIC, sizeof(STORAGE_MAGIC));
+        write_value<uint64_t>(stream, _cache.size());
+
+        for (auto const &[which, cached] : _cache) {
+            auto const &digits = cached.value.digits();
+            write_value<uint32_t>(stream, static_cast<uint32_t>(which));
+            write_value<uint64_t>(stream, cached.bits);
+            write_value<uint64_t>(stream, digits.size());
+            stream.write(reinterpret_cast<const char *>(digits.data()),
+                         static_cast<std::streamsize>(digits.size() * sizeof(unsigned int)));
+        }
+
+        if (!stream) {
+            throw std::runtime_error("Cannot write constants storage " + temporary.string());
+        }
+    }
+
+    std::filesystem::rename(temporary, *_storage);
+}
+
+void constants::load()
+{
+    if (!_storage || !std::filesystem::exists(*_storage)) {
+        return;
+    }
+
+    std::error_code error;
+    const uint64_t file_size = std::filesystem::file_size(*_storage, error);
+    if (error) {
+        return;
+    }
+
+    std::ifstream stream(*_storage, std::ios::binary);
+    char magic[sizeof(STORAGE_MAGIC)];
+    uint64_t count = 0;
+
+    if (!stream.read(magic, sizeof(magic)) || !std::equal(magic, magic + sizeof(magic), STORAGE_MAGIC)
+        || !read_value(stream, count)) {
+        return;
+    }
+
+    // storage is a cache only: malformed file is ignored as a whole and rewritten on next extension
+    std::map<constant, entry> loaded;
+    for (uint64_t i = 0; i < count; ++i) {
+        uint32_t which = 0;
+        uint64_t bits = 0;
+        uint64_t size = 0;
+
+        if (!read_value(stream, which) || !read_value(stream, bits) || !read_value(stream, size)
+            || which > static_cast<uint32_t>(constant::e)) {
+            return;
+        }
+
+        // sizes are checked before allocation: digits have to fit into the rest of the file
+        // and into bits of the stored value, which is below 4 * 2^bits
+        const uint64_t remaining = file_size - static_cast<uint64_t>(stream.tellg());
+        if (size == 0 || size > remaining / sizeof(unsigned int)
+            || size > bits / (8 * sizeof(unsigned int)) + 3) {
+            return;
+        }
+
+        std::vector<unsigned int> digits(size);
+        if (!stream.read(reinterpret_cast<char *>(digits.data()),
+                         static_cast<std::streamsize>(size * sizeof(unsigned int)))) {
+            return;
+        }
+
+        loaded[static_cast<constant>(which)] = entry{bits, big_int(digits)};
+    }
+
+    _cache = std::move(loaded);
+}
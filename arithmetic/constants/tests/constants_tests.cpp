@@ -0,0 +1,146 @@
+#include <gtest/gtest.h>
+
+#include <constants.h>
+#include <client_logger.h>
+#include <client_logger_builder.h>
+#include <fstream>
+
+logger *create_logger(
+    std::vector<std::pair<std::string, logger::severity>> const &output_file_streams_setup,
+    bool use_console_stream = true,
+    logger::severity console_stream_severity = logger::severity::debug)
+{
+    logger_builder *builder = new client_logger_builder();
+
+    if (use_console_stream)
+    {
+        builder->add_console_stream(console_stream_severity);
+    }
+
+    for (auto &output_file_stream_setup: output_file_streams_setup)
+    {
+        builder->add_file_stream(output_file_stream_setup.first, output_file_stream_setup.second);
+    }
+
+    logger *built_logger = builder->build();
+
+    delete builder;
+
+    return built_logger;
+}
+
+TEST(positive_tests_constants, test1)
+{
+    logger *logger = create_logger(std::vector<std::pair<std::string, logger::severity>>
+        {
+            {
+                "bigint_logs.txt",
+                logger::severity::information
+            },
+        });
+
+    constants service;
+
+    EXPECT_TRUE(service.decimal(constants::constant::pi, 50) ==
+                big_int("314159265358979323846264338327950288419716939937510"));
+    EXPECT_TRUE(service.decimal(constants::constant::e, 50) ==
+                big_int("271828182845904523536028747135266249775724709369995"));
+
+    // lower precision is served from cache by truncation
+    size_t cached = service.cached_bits(constants::constant::pi);
+    EXPECT_TRUE(service.pi(64) == big_int("57952155664616982739"));
+    EXPECT_EQ(service.cached_bits(constants::constant::pi), cached);
+
+    delete logger;
+}
+
+TEST(positive_tests_constants, test2)
+{
+    logger *logger = create_logger(std::vector<std::pair<std::string, logger::severity>>
+        {
+            {
+                "bigint_logs.txt",
+                logger::severity::information
+            },
+        });
+
+    auto storage = std::filesystem::temp_directory_path() / "mp_os_constants_test.bin";
+    std::filesystem::remove(storage);
+
+    big_int pi;
+    big_int e;
+    {
+        constants service(storage);
+        pi = service.pi(1000);
+        e = service.e(1000);
+    }
+
+    constants restored(storage);
+    EXPECT_GE(restored.cached_bits(constants::constant::pi), 1000);
+    EXPECT_GE(restored.cached_bits(constants::constant::e), 1000);
+    EXPECT_TRUE(restored.pi(1000) == pi);
+    EXPECT_TRUE(restored.e(1000) == e);
+
+    std::filesystem::remove(storage);
+
+    delete logger;
+}
+
+TEST(negative_tests_constants, test1)
+{
+    logger *logger = create_logger(std::vector<std::pair<std::string, logger::severity>>
+        {
+            {
+                "bigint_logs.txt",
+                logger::severity::information
+            },
+        });
+
+    auto storage = std::filesystem::temp_directory_path() / "mp_os_constants_corrupted.bin";
+    {
+        std::ofstream stream(storage, std::ios::binary | std::ios::trunc);
+        stream << "definitely not a constants cache";
+    }
+
+    constants service(storage);
+    EXPECT_EQ(service.cached_bits(constants::constant::pi), 0);
+    EXPECT_TRUE(service.decimal(constants::constant::pi, 10) == big_int("31415926535"));
+
+    std::filesystem::remove(storage);
+
+    delete logger;
+}
+
+TEST(negative_tests_constants, test2)
+{
+    auto storage = std::filesystem::temp_directory_path() / "mp_os_constants_truncated.bin";
+    {
+        std::ofstream stream(storage, std::ios::binary | std::ios::trunc);
+        const char magic[8] = {'M', 'P', 'C', 'N', 'S', 'T', '0', '1'};
+        const uint64_t count = 1;
+        const uint32_t which = 0;
+        const uint64_t bits = 64;
+        const uint64_t size = uint64_t(1) << 60;
+
+        stream.write(magic, sizeof(magic));
+        stream.write(reinterpret_cast<const char *>(&count), sizeof(count));
+        stream.write(reinterpret_cast<const char *>(&which), sizeof(which));
+        stream.write(reinterpret_cast<const char *>(&bits), sizeof(bits));
+        stream.write(reinterpret_cast<const char *>(&size), sizeof(size));
+    }
+
+    constants service(storage);
+    EXPECT_EQ(service.cached_bits(constants::constant::pi), 0);
+    EXPECT_TRUE(service.decimal(constants::constant::pi, 10) == big_int("31415926535"));
+
+    std::filesystem::remove(storage);
+}
+
+int main(
+    int argc,
+    char **argv)
+{
+    testing::InitGoogleTest(&argc, argv);
+
+    return RUN_ALL_TESTS();
+}
@@ -1,14 +1,126 @@
 #ifndef MP_OS_CONTINUED_FRACTION_H
 #define MP_OS_CONTINUED_FRACTION_H
 
+#include <array>
+#include <deque>
+#include <functional>
+#include <optional>
 #include <vector>
 
 #include <big_int.h>
 #include <fraction.h>
+#include <interval.h>
 
 class continued_fraction final
 {
 
+public:
+
+    /** Source of partial quotients, std::nullopt once exhausted; a stream without terms is infinity
+     */
+    using term_stream = std::function<std::optional<big_int>()>;
+
+    /** Lazy expansion of a rational into partial quotients and convergents.
+     *  State is the current remainder pair and the last two convergents, updated in place:
+     *  while remainders are long, Lehmer steps on their leading 62 bits produce several
+     *  quotients per one pass over the big numbers.
+     */
+    class term_generator final
+    {
+
+    private:
+
+        big_int _numerator;
+        big_int _denominator;
+        bool _started = false;
+
+        std::deque<big_int> _pending;
+
+        // h_k, h_(k-1), k_k, k_(k-1)
+        big_int _convergent_numerator;
+        big_int _previous_numerator;
+        big_int _convergent_denominator;
+        big_int _previous_denominator;
+
+    public:
+
+        explicit term_generator(fraction const &value);
+
+    public:
+
+        bool has_next() const noexcept;
+
+        /** Next partial quotient, the first one is floor of value and may be negative
+         *  @throw std::out_of_range if expansion is exhausted
+         */
+        big_int next();
+
+        /** Last convergent h_k / k_k
+         *  @throw std::out_of_range before the first term, as 1 / 0 is not a fraction
+         */
+        fraction convergent() const;
+
+        big_int const &convergent_numerator() const noexcept;
+
+        big_int const &convergent_denominator() const noexcept;
+
+        /** Convergent before the last one h_(k-1) / k_(k-1), 0 / 1 before the first term
+         */
+        big_int const &previous_convergent_numerator() const noexcept;
+
+        big_int const &previous_convergent_denominator() const noexcept;
+
+    private:
+
+        void refill();
+
+        void advance(big_int const &term);
+
+    };
+
+    /** Path in a tree of positive rationals stored as lengths of alternating runs of steps,
+     *  for Stern-Brocot tree they are partial quotients with the last one decreased
+     */
+    class tree_path final
+    {
+
+    private:
+
+        bool _first_right;
+        std::vector<big_int> _runs;
+
+    public:
+
+        /** Empty runs are dropped and neighbouring runs of the same direction are merged
+         *  @throw std::invalid_argument if a run is negative
+         */
+        explicit tree_path(std::vector<big_int> runs = {}, bool first_right = true);
+
+        explicit tree_path(std::vector<bool> const &path);
+
+    public:
+
+        bool first_right() const noexcept;
+
+        /** Positive lengths, directions alternate starting from first_right()
+         */
+        std::vector<big_int> const &runs() const noexcept;
+
+        big_int length() const;
+
+        /** Path read from the end
+         */
+        tree_path reversed() const;
+
+        /** One element per step
+         *  @throw std::length_error if path is too long to be expanded
+         */
+        std::vector<bool> expand() const;
+
+        bool operator==(tree_path const &other) const;
+
+    };
+
 private:
 
     continued_fraction() = default;
@@ -27,18 +139,95 @@ public:
     static std::vector<fraction> to_convergents_series(
         std::vector<big_int> const &continued_fraction_representation);
 
+    /** Closest fraction with denominator not above max_denominator, the smaller denominator on a tie.
+     *  Expansion stops at the first convergent exceeding the bound, so only the semiconvergent
+     *  at the cutoff and the last convergent are compared
+     *  @throw std::invalid_argument if max_denominator < 1
+     */
+    static fraction best_approximation(
+        fraction const &value,
+        big_int const &max_denominator);
+
+    /** Simplest fraction inside bounds: the one with the smallest denominator, and the smallest
+     *  absolute numerator among them. Terms of both endpoints are generated only while they agree
+     *  @throw std::invalid_argument if max_denominator < 1
+     *  @throw std::domain_error if every fraction inside bounds has denominator above max_denominator
+     */
+    static fraction best_approximation(
+        interval const &bounds,
+        big_int const &max_denominator);
+
+    static term_stream terms(
+        fraction const &value);
+
+    static term_stream terms(
+        std::vector<big_int> continued_fraction_representation);
+
+    /** Gosper's algorithm: terms of (a * x * y + b * x + c * y + d) / (e * x * y + f * x + g * y + h)
+     *  are produced lazily, a term is output once every corner of the input ranges agrees on it.
+     *  State is the eight coefficients only. Output may stall forever if inputs are infinite
+     *  and the result is rational, e.g. sqrt(2) * sqrt(2)
+     */
+    static term_stream bihomographic(
+        term_stream x,
+        term_stream y,
+        std::array<big_int, 8> coefficients);
+
+    /** Terms of (a * x + b) / (c * x + d)
+     */
+    static term_stream mobius(
+        term_stream x,
+        big_int a,
+        big_int b,
+        big_int c,
+        big_int d);
+
+    static term_stream sum(
+        term_stream x,
+        term_stream y);
+
+    static term_stream difference(
+        term_stream x,
+        term_stream y);
+
+    static term_stream product(
+        term_stream x,
+        term_stream y);
+
+    static term_stream quotient(
+        term_stream x,
+        term_stream y);
+
+    /** true is a step to the right (greater) child, false to the left one
+     */
     static std::vector<bool> to_Stern_Brokot_tree_path(
         fraction const &value);
 
     static fraction from_Stern_Brokot_tree_path(
         std::vector<bool> const &path);
 
+    /** Same path as to_Stern_Brokot_tree_path, run lengths are taken from partial quotients directly
+     */
+    static tree_path to_Stern_Brokot_tree_runs(
+        fraction const &value);
+
+    static fraction from_Stern_Brokot_tree_runs(
+        tree_path const &path);
+
+    /** true is a step to the right child (a + b) / b, false to the left one a / (a + b)
+     */
     static std::vector<bool> to_Calkin_Wilf_tree_path(
         fraction const &value);
 
     static fraction from_Calkin_Wilf_tree_path(
         std::vector<bool> const &path);
 
+    static tree_path to_Calkin_Wilf_tree_runs(
+        fraction const &value);
+
+    static fraction from_Calkin_Wilf_tree_runs(
+        tree_path const &path);
+
 };
 
-#endif //MP_OS_CONTINUED_FRACTION_H
\ No newline at end of file
+#endif //MP_OS_CONTINUED_FRACTION_H
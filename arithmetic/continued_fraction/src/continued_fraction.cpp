@@ -1,51 +1,966 @@
 #include "../include/continued_fraction.h"
 
-#include <not_implemented.h>
+#include <algorithm>
+#include <bit>
+#include <future>
+#include <limits>
+#include <memory>
+#include <stdexcept>
+#include <thread>
+#include <utility>
+
+namespace
+{
+    /** Leading part of remainders simulated in machine words by Lehmer steps,
+     *  cofactors stay below 2^62 so their products with quotients fit in __int128
+     */
+    constexpr size_t LEHMER_BITS = 62;
+
+    constexpr unsigned long long LEHMER_MODULUS = 1ULL << LEHMER_BITS;
+
+    /** Euclid floor division of numerator by positive denominator, numerator becomes the remainder
+     */
+    big_int floor_divide(big_int &numerator, big_int const &denominator)
+    {
+        big_int quotient = numerator / denominator;
+        numerator -= quotient * denominator;
+
+        if (numerator.is_negative())
+        {
+            numerator += denominator;
+            --quotient;
+        }
+
+        return quotient;
+    }
+
+    size_t expanded_size(big_int const &length, size_t max_size)
+    {
+        if (length.bit_length() >= std::numeric_limits<size_t>::digits
+            || length.mod_word(std::numeric_limits<unsigned long long>::max()) > max_size)
+        {
+            throw std::length_error("Tree path is too long to be expanded");
+        }
+
+        return static_cast<size_t>(length.mod_word(std::numeric_limits<unsigned long long>::max()));
+    }
+
+    /** Stern-Brocot path runs are partial quotients with the last one decreased, leading zero
+     *  quotient of a value below 1 is an empty first run to the right
+     */
+    std::vector<big_int> Stern_Brokot_terms(continued_fraction::tree_path const &path)
+    {
+        std::vector<big_int> terms;
+        if (!path.first_right() && !path.runs().empty())
+        {
+            terms.emplace_back(0);
+        }
+
+        terms.insert(terms.end(), path.runs().begin(), path.runs().end());
+        if (terms.empty())
+        {
+            terms.emplace_back(0);
+        }
+
+        ++terms.back();
+        return terms;
+    }
+
+    /** z = (a * x * y + b * x + c * y + d) / (e * x * y + f * x + g * y + h), coefficients in this order.
+     *  Inputs are canonical continued fractions, so after the first term every tail is at least 1
+     *  and z is bounded by its values at corners x, y in {0, infinity}: a / e, b / f, c / g, d / h
+     */
+    class bihomographic_engine final
+    {
+
+    private:
+
+        continued_fraction::term_stream _x;
+        continued_fraction::term_stream _y;
+
+        std::array<big_int, 8> _coefficients;
+
+        bool _x_started = false;
+        bool _y_started = false;
+        bool _x_finished = false;
+        bool _y_finished = false;
+        bool _x_last = false;
+
+    public:
+
+        bihomographic_engine(
+            continued_fraction::term_stream x,
+            continued_fraction::term_stream y,
+            std::array<big_int, 8> coefficients)
+                : _x(std::move(x)), _y(std::move(y)), _coefficients(std::move(coefficients))
+        {
+        }
+
+    public:
+
+        std::optional<big_int> next()
+        {
+            auto &[a, b, c, d, e, f, g, h] = _coefficients;
+
+            while (!(e.is_zero() && f.is_zero() && g.is_zero() && h.is_zero()))
+            {
+                if (auto term = common_floor())
+                {
+                    // z <- 1 / (z - term)
+                    for (size_t i = 0; i < 4; ++i)
+                    {
+                        _coefficients[i] -= *term * _coefficients[i + 4];
+                        std::swap(_coefficients[i], _coefficients[i + 4]);
+                    }
+
+                    return term;
+                }
+
+                ingest_x_next() ? ingest_x() : ingest_y();
+            }
+
+            return std::nullopt;
+        }
+
+    private:
+
+        std::optional<big_int> common_floor() const
+        {
+            if (!(_x_started || _x_finished) || !(_y_started || _y_finished))
+            {
+                return std::nullopt;
+            }
+
+            // corners with x = infinity vanish once x is exhausted, the same for y
+            std::optional<big_int> result;
+            bool negative = _coefficients[7].is_negative();
+
+            for (size_t corner = 0; corner < 4; ++corner)
+            {
+                if ((_x_finished && corner < 2) || (_y_finished && corner % 2 == 0))
+                {
+                    continue;
+                }
+
+                big_int numerator = _coefficients[corner];
+                big_int denominator = _coefficients[corner + 4];
+                if (denominator.is_zero() || denominator.is_negative() != negative)
+                {
+                    return std::nullopt;
+                }
+
+                if (negative)
+                {
+                    numerator = -numerator;
+                    denominator = -denominator;
+                }
+
+                big_int term = floor_divide(numerator, denominator);
+                if (result && *result != term)
+                {
+                    return std::nullopt;
+                }
+
+                result = std::move(term);
+            }
+
+            return result;
+        }
+
+        bool ingest_x_next() const
+        {
+            if (!_x_started || _y_finished)
+            {
+                return true;
+            }
+
+            if (!_y_started || _x_finished)
+            {
+                return false;
+            }
+
+            auto const &[a, b, c, d, e, f, g, h] = _coefficients;
+            if (e.is_zero() || f.is_zero() || g.is_zero() || h.is_zero())
+            {
+                // ingestion of one input alone may keep a corner at infinity forever
+                return !_x_last;
+            }
+
+            // |b / f - d / h| > |c / g - d / h|, common factor |h| is cancelled
+            return ((b * h - d * f) * g).cmp_abs((c * h - d * g) * f) == std::strong_ordering::greater;
+        }
+
+        void ingest_x()
+        {
+            _x_started = true;
+            _x_last = true;
+            auto &[a, b, c, d, e, f, g, h] = _coefficients;
+
+            if (auto term = _x())
+            {
+                // x <- term + 1 / x
+                ingest(a, c, *term);
+                ingest(b, d, *term);
+                ingest(e, g, *term);
+                ingest(f, h, *term);
+            }
+            else
+            {
+                _x_finished = true;
+                c = std::exchange(a, big_int(0));
+                d = std::exchange(b, big_int(0));
+                g = std::exchange(e, big_int(0));
+                h = std::exchange(f, big_int(0));
+            }
+        }
+
+        void ingest_y()
+        {
+            _y_started = true;
+            _x_last = false;
+            auto &[a, b, c, d, e, f, g, h] = _coefficients;
+
+            if (auto term = _y())
+            {
+                ingest(a, b, *term);
+                ingest(c, d, *term);
+                ingest(e, f, *term);
+                ingest(g, h, *term);
+            }
+            else
+            {
+                _y_finished = true;
+                b = std::exchange(a, big_int(0));
+                d = std::exchange(c, big_int(0));
+                f = std::exchange(e, big_int(0));
+                h = std::exchange(g, big_int(0));
+            }
+        }
+
+        /** (high, low) <- (high * term + low, high) for a pair of coefficients of the same power of other input
+         */
+        static void ingest(big_int &high, big_int &low, big_int const &term)
+        {
+            low += high * term;
+            std::swap(high, low);
+        }
+
+    };
+
+    /** Ranges of terms up to this size are multiplied by the convergent recurrence
+     */
+    constexpr size_t PRODUCT_TREE_LEAF_SIZE = 16;
+
+    /** Subtrees below this size are not worth a thread
+     */
+    constexpr size_t PARALLEL_MIN_TERMS = 1 << 12;
+
+    /** Product of [[a, 1], [1, 0]] over a range of terms: [[numerator, previous numerator], [denominator, previous denominator]],
+     *  identity for an empty range
+     */
+    struct convergent_matrix
+    {
+        big_int numerator = big_int(1);
+        big_int previous_numerator = big_int(0);
+        big_int denominator = big_int(0);
+        big_int previous_denominator = big_int(1);
+
+        void append(big_int const &term)
+        {
+            std::swap(numerator, previous_numerator);
+            numerator += previous_numerator * term;
+
+            std::swap(denominator, previous_denominator);
+            denominator += previous_denominator * term;
+        }
+    };
+
+    big_int multiply(big_int const &lhs, big_int const &rhs)
+    {
+        big_int result(lhs);
+        result.multiply_assign(rhs, big_int::multiplication_rule::Karatsuba);
+        return result;
+    }
+
+    convergent_matrix operator*(convergent_matrix const &lhs, convergent_matrix const &rhs)
+    {
+        convergent_matrix result;
+
+        result.numerator = multiply(lhs.numerator, rhs.numerator) + multiply(lhs.previous_numerator, rhs.denominator);
+        result.previous_numerator = multiply(lhs.numerator, rhs.previous_numerator) + multiply(lhs.previous_numerator, rhs.previous_denominator);
+        result.denominator = multiply(lhs.denominator, rhs.numerator) + multiply(lhs.previous_denominator, rhs.denominator);
+        result.previous_denominator = multiply(lhs.denominator, rhs.previous_numerator) + multiply(lhs.previous_denominator, rhs.previous_denominator);
+
+        return result;
+    }
+
+    /** Node of balanced product tree, leaves cover up to PRODUCT_TREE_LEAF_SIZE terms
+     */
+    struct product_node
+    {
+        convergent_matrix value;
+        std::unique_ptr<product_node> left;
+        std::unique_ptr<product_node> right;
+    };
+
+    /** Levels of recursion whose halves run on separate threads
+     */
+    size_t parallel_depth()
+    {
+        return std::bit_width(std::max(std::thread::hardware_concurrency(), 1u)) - 1;
+    }
+
+    /** Runs both calls, the first one on a separate thread if allowed
+     */
+    template<typename First, typename Second>
+    void run_both(bool parallel, First &&first, Second &&second)
+    {
+        if (!parallel)
+        {
+            first();
+            second();
+            return;
+        }
+
+        auto result = std::async(std::launch::async, std::forward<First>(first));
+        second();
+        result.get();
+    }
+
+    std::unique_ptr<product_node> product_tree(
+        std::vector<big_int> const &terms,
+        size_t from,
+        size_t to,
+        size_t depth)
+    {
+        auto node = std::make_unique<product_node>();
+
+        if (to - from <= PRODUCT_TREE_LEAF_SIZE)
+        {
+            for (size_t i = from; i < to; ++i)
+            {
+                node->value.append(terms[i]);
+            }
+
+            return node;
+        }
+
+        size_t middle = from + (to - from) / 2;
+        size_t child_depth = depth == 0 ? 0 : depth - 1;
+        run_both(depth > 0 && to - from >= PARALLEL_MIN_TERMS,
+                 [&]() { node->left = product_tree(terms, from, middle, child_depth); },
+                 [&]() { node->right = product_tree(terms, middle, to, child_depth); });
+
+        node->value = node->left->value * node->right->value;
+        return node;
+    }
+
+    /** Prefix product before a subtree is passed down, the right child gets it multiplied by the left child
+     */
+    void descend(
+        product_node const &node,
+        std::vector<big_int> const &terms,
+        size_t from,
+        size_t to,
+        convergent_matrix const &prefix,
+        std::vector<fraction> &convergents,
+        size_t depth)
+    {
+        if (!node.left)
+        {
+            convergent_matrix current = prefix;
+            for (size_t i = from; i < to; ++i)
+            {
+                current.append(terms[i]);
+                convergents[i] = fraction::from_coprime(current.numerator, current.denominator);
+            }
+
+            return;
+        }
+
+        size_t middle = from + (to - from) / 2;
+        size_t child_depth = depth == 0 ? 0 : depth - 1;
+        run_both(depth > 0 && to - from >= PARALLEL_MIN_TERMS,
+                 [&]() { descend(*node.left, terms, from, middle, prefix, convergents, child_depth); },
+                 [&]() { descend(*node.right, terms, middle, to, prefix * node.left->value, convergents, child_depth); });
+    }
+
+    void check_max_denominator(big_int const &max_denominator)
+    {
+        if (max_denominator < big_int(1))
+        {
+            throw std::invalid_argument("Maximal denominator must be positive");
+        }
+    }
+
+    /** Simplest fraction of closed interval [lower_numerator / lower_denominator, upper_numerator / upper_denominator]
+     *  with 0 < lower <= upper. Every step takes the common partial quotient of both endpoints and
+     *  continues with reciprocals of their remainders, swapped
+     */
+    fraction simplest_positive(
+        big_int lower_numerator,
+        big_int lower_denominator,
+        big_int upper_numerator,
+        big_int upper_denominator,
+        big_int const &max_denominator)
+    {
+        big_int numerator(1), previous_numerator(0);
+        big_int denominator(0), previous_denominator(1);
+
+        for (bool last = false; !last;)
+        {
+            big_int term = lower_numerator / lower_denominator;
+            lower_numerator -= term * lower_denominator;
+
+            if (!lower_numerator.is_zero())
+            {
+                // smallest integer above lower end is inside the interval
+                last = (term + big_int(1)) * upper_denominator <= upper_numerator;
+                if (last)
+                {
+                    ++term;
+                }
+            }
+            else
+            {
+                last = true;
+            }
+
+            std::swap(numerator, previous_numerator);
+            numerator += previous_numerator * term;
+
+            std::swap(denominator, previous_denominator);
+            denominator += previous_denominator * term;
+
+            if (denominator > max_denominator)
+            {
+                throw std::domain_error("Interval contains no fraction with bounded denominator");
+            }
+
+            if (!last)
+            {
+                upper_numerator -= term * upper_denominator;
+                std::swap(lower_numerator, upper_denominator);
+                std::swap(lower_denominator, upper_numerator);
+            }
+        }
+
+        return fraction::from_coprime(std::move(numerator), std::move(denominator));
+    }
+
+    void check_positive(fraction const &value)
+    {
+        if (value.numerator().is_zero() || value.numerator().is_negative() != value.denominator().is_negative())
+        {
+            throw std::invalid_argument("Tree of rationals contains positive numbers only");
+        }
+    }
+}
+
+continued_fraction::term_generator::term_generator(fraction const &value)
+        : _numerator(value.numerator()), _denominator(value.denominator()),
+          _convergent_numerator(1), _previous_numerator(0),
+          _convergent_denominator(0), _previous_denominator(1)
+{
+    if (_denominator.is_negative())
+    {
+        _numerator = -_numerator;
+        _denominator = -_denominator;
+    }
+}
+
+bool continued_fraction::term_generator::has_next() const noexcept
+{
+    return !_pending.empty() || !_denominator.is_zero();
+}
+
+big_int continued_fraction::term_generator::next()
+{
+    if (_pending.empty())
+    {
+        if (_denominator.is_zero())
+        {
+            throw std::out_of_range("Continued fraction expansion is exhausted");
+        }
+
+        refill();
+    }
+
+    big_int term = std::move(_pending.front());
+    _pending.pop_front();
+    advance(term);
+
+    return term;
+}
+
+fraction continued_fraction::term_generator::convergent() const
+{
+    if (_convergent_denominator.is_zero())
+    {
+        throw std::out_of_range("Continued fraction has no convergent before the first term");
+    }
+
+    return fraction::from_coprime(_convergent_numerator, _convergent_denominator);
+}
+
+big_int const &continued_fraction::term_generator::convergent_numerator() const noexcept
+{
+    return _convergent_numerator;
+}
+
+big_int const &continued_fraction::term_generator::convergent_denominator() const noexcept
+{
+    return _convergent_denominator;
+}
+
+big_int const &continued_fraction::term_generator::previous_convergent_numerator() const noexcept
+{
+    return _previous_numerator;
+}
+
+big_int const &continued_fraction::term_generator::previous_convergent_denominator() const noexcept
+{
+    return _previous_denominator;
+}
+
+void continued_fraction::term_generator::advance(big_int const &term)
+{
+    // h_(k+1) = a * h_k + h_(k-1), the same for k
+    std::swap(_convergent_numerator, _previous_numerator);
+    _convergent_numerator += _previous_numerator * term;
+
+    std::swap(_convergent_denominator, _previous_denominator);
+    _convergent_denominator += _previous_denominator * term;
+}
+
+void continued_fraction::term_generator::refill()
+{
+    if (!_started)
+    {
+        // only the first quotient may be non-positive, remainders are non-negative afterwards
+        _started = true;
+        _pending.push_back(floor_divide(_numerator, _denominator));
+        std::swap(_numerator, _denominator);
+        return;
+    }
+
+    if (_numerator.bit_length() <= LEHMER_BITS)
+    {
+        unsigned long long x = _numerator.mod_word(LEHMER_MODULUS);
+        unsigned long long y = _denominator.mod_word(LEHMER_MODULUS);
+
+        while (y != 0)
+        {
+            _pending.emplace_back(x / y);
+            x = std::exchange(y, x % y);
+        }
+
+        _numerator = big_int(x);
+        _denominator = big_int(0);
+        return;
+    }
+
+    // Knuth's algorithm L: a quotient is taken only when both bounds of the leading parts agree on it
+    const size_t shift = _numerator.bit_length() - LEHMER_BITS;
+    __int128 x = static_cast<__int128>((_numerator >> shift).mod_word(LEHMER_MODULUS));
+    __int128 y = static_cast<__int128>((_denominator >> shift).mod_word(LEHMER_MODULUS));
+    __int128 a = 1, b = 0, c = 0, d = 1;
+
+    while (y + c > 0 && y + d > 0)
+    {
+        __int128 quotient = (x + a) / (y + c);
+        if (quotient != (x + b) / (y + d))
+        {
+            break;
+        }
+
+        a = std::exchange(c, a - quotient * c);
+        b = std::exchange(d, b - quotient * d);
+        x = std::exchange(y, x - quotient * y);
+        _pending.emplace_back(static_cast<long long>(quotient));
+    }
+
+    if (b == 0)
+    {
+        _pending.push_back(floor_divide(_numerator, _denominator));
+        std::swap(_numerator, _denominator);
+        return;
+    }
+
+    big_int numerator = _numerator * big_int(static_cast<long long>(a));
+    numerator += _denominator * big_int(static_cast<long long>(b));
+
+    _denominator *= big_int(static_cast<long long>(d));
+    _denominator += _numerator * big_int(static_cast<long long>(c));
+    _numerator = std::move(numerator);
+}
 
 std::vector<big_int> continued_fraction::to_continued_fraction_representation(
     fraction const &value)
 {
-    throw not_implemented("std::vector<big_integer> continued_fraction::to_continued_fraction_representation(fraction const &)", "your code should be here...");
+    std::vector<big_int> terms;
+
+    for (term_generator generator(value); generator.has_next();)
+    {
+        terms.push_back(generator.next());
+    }
+
+    return terms;
 }
 
 fraction continued_fraction::from_continued_fraction_representation(
     std::vector<big_int> const &continued_fraction_representation)
 {
-    throw not_implemented("fraction continued_fraction::from_continued_fraction_representation(std::vector<big_integer> const &)", "your code should be here...");
+    if (continued_fraction_representation.empty())
+    {
+        throw std::invalid_argument("Continued fraction representation must contain at least one term");
+    }
+
+    convergent_matrix product = product_tree(continued_fraction_representation, 0,
+                                             continued_fraction_representation.size(), parallel_depth())->value;
+
+    if (product.denominator.is_zero())
+    {
+        throw std::invalid_argument("Continued fraction representation has zero denominator");
+    }
+
+    return fraction::from_coprime(std::move(product.numerator), std::move(product.denominator));
 }
 
 std::vector<fraction> continued_fraction::to_convergents_series(
     fraction const &value)
 {
-    throw not_implemented("std::vector<fraction> continued_fraction::to_convergents_series(fraction const &)", "your code should be here...");
+    std::vector<fraction> convergents;
+
+    for (term_generator generator(value); generator.has_next();)
+    {
+        generator.next();
+        convergents.push_back(generator.convergent());
+    }
+
+    return convergents;
 }
 
 std::vector<fraction> continued_fraction::to_convergents_series(
     std::vector<big_int> const &continued_fraction_representation)
 {
-    throw not_implemented("std::vector<fraction> continued_fraction::to_convergents_series(std::vector<big_integer> const &)", "your code should be here...");
+    std::vector<fraction> convergents(continued_fraction_representation.size());
+
+    if (!continued_fraction_representation.empty())
+    {
+        auto root = product_tree(continued_fraction_representation, 0,
+                                 continued_fraction_representation.size(), parallel_depth());
+        descend(*root, continued_fraction_representation, 0, continued_fraction_representation.size(),
+                convergent_matrix(), convergents, parallel_depth());
+    }
+
+    return convergents;
+}
+
+fraction continued_fraction::best_approximation(
+    fraction const &value,
+    big_int const &max_denominator)
+{
+    check_max_denominator(max_denominator);
+
+    term_generator generator(value);
+    big_int term;
+
+    do
+    {
+        term = generator.next();
+    }
+    while (generator.convergent_denominator() <= max_denominator && generator.has_next());
+
+    if (generator.convergent_denominator() <= max_denominator)
+    {
+        return value;
+    }
+
+    // h_(k-1) / k_(k-1) is the last convergent within the bound, h_(k-2) = h_k - a * h_(k-1)
+    big_int const &numerator = generator.previous_convergent_numerator();
+    big_int const &denominator = generator.previous_convergent_denominator();
+
+    big_int semiconvergent_numerator = generator.convergent_numerator() - term * numerator;
+    big_int semiconvergent_denominator = generator.convergent_denominator() - term * denominator;
+
+    big_int steps = (max_denominator - semiconvergent_denominator) / denominator;
+
+    fraction convergent = fraction::from_coprime(numerator, denominator);
+    if (steps.is_zero())
+    {
+        return convergent;
+    }
+
+    semiconvergent_numerator += steps * numerator;
+    semiconvergent_denominator += steps * denominator;
+    fraction semiconvergent = fraction::from_coprime(std::move(semiconvergent_numerator), std::move(semiconvergent_denominator));
+
+    return (value - semiconvergent).abs() < (value - convergent).abs()
+        ? semiconvergent
+        : convergent;
+}
+
+fraction continued_fraction::best_approximation(
+    interval const &bounds,
+    big_int const &max_denominator)
+{
+    check_max_denominator(max_denominator);
+
+    fraction const &lower = bounds.lower();
+    fraction const &upper = bounds.upper();
+    fraction zero(big_int(0), big_int(1));
+
+    if (lower <= zero && zero <= upper)
+    {
+        return zero;
+    }
+
+    if (lower > zero)
+    {
+        return simplest_positive(lower.numerator(), lower.denominator(),
+                                 upper.numerator(), upper.denominator(), max_denominator);
+    }
+
+    return -simplest_positive(-upper.numerator(), upper.denominator(),
+                              -lower.numerator(), lower.denominator(), max_denominator);
+}
+
+continued_fraction::term_stream continued_fraction::terms(
+    fraction const &value)
+{
+    auto generator = std::make_shared<term_generator>(value);
+
+    return [generator]() -> std::optional<big_int>
+    {
+        if (!generator->has_next())
+        {
+            return std::nullopt;
+        }
+
+        return generator->next();
+    };
+}
+
+continued_fraction::term_stream continued_fraction::terms(
+    std::vector<big_int> continued_fraction_representation)
+{
+    auto representation = std::make_shared<std::vector<big_int>>(std::move(continued_fraction_representation));
+    auto position = std::make_shared<size_t>(0);
+
+    return [representation, position]() -> std::optional<big_int>
+    {
+        if (*position == representation->size())
+        {
+            return std::nullopt;
+        }
+
+        return (*representation)[(*position)++];
+    };
+}
+
+continued_fraction::term_stream continued_fraction::bihomographic(
+    term_stream x,
+    term_stream y,
+    std::array<big_int, 8> coefficients)
+{
+    auto engine = std::make_shared<bihomographic_engine>(std::move(x), std::move(y), std::move(coefficients));
+
+    return [engine]()
+    {
+        return engine->next();
+    };
+}
+
+continued_fraction::term_stream continued_fraction::mobius(
+    term_stream x,
+    big_int a,
+    big_int b,
+    big_int c,
+    big_int d)
+{
+    // y is infinity, so (a * x * y + b * y) / (c * x * y + d * y) is left
+    return bihomographic(std::move(x), terms(std::vector<big_int>()),
+                         {std::move(a), big_int(0), std::move(b), big_int(0),
+                          std::move(c), big_int(0), std::move(d), big_int(0)});
+}
+
+continued_fraction::term_stream continued_fraction::sum(
+    term_stream x,
+    term_stream y)
+{
+    return bihomographic(std::move(x), std::move(y),
+                         {big_int(0), big_int(1), big_int(1), big_int(0), big_int(0), big_int(0), big_int(0), big_int(1)});
+}
+
+continued_fraction::term_stream continued_fraction::difference(
+    term_stream x,
+    term_stream y)
+{
+    return bihomographic(std::move(x), std::move(y),
+                         {big_int(0), big_int(1), big_int(-1), big_int(0), big_int(0), big_int(0), big_int(0), big_int(1)});
+}
+
+continued_fraction::term_stream continued_fraction::product(
+    term_stream x,
+    term_stream y)
+{
+    return bihomographic(std::move(x), std::move(y),
+                         {big_int(1), big_int(0), big_int(0), big_int(0), big_int(0), big_int(0), big_int(0), big_int(1)});
+}
+
+continued_fraction::term_stream continued_fraction::quotient(
+    term_stream x,
+    term_stream y)
+{
+    return bihomographic(std::move(x), std::move(y),
+                         {big_int(0), big_int(1), big_int(0), big_int(0), big_int(0), big_int(0), big_int(1), big_int(0)});
+}
+
+continued_fraction::tree_path::tree_path(std::vector<big_int> runs, bool first_right)
+        : _first_right(first_right)
+{
+    bool right = first_right;
+
+    for (auto &run : runs)
+    {
+        if (run.is_negative())
+        {
+            throw std::invalid_argument("Run length must be non-negative");
+        }
+
+        if (!run.is_zero())
+        {
+            if (_runs.empty())
+            {
+                _first_right = right;
+                _runs.push_back(std::move(run));
+            }
+            else if (right == (_first_right == (_runs.size() % 2 == 1)))
+            {
+                _runs.back() += run;
+            }
+            else
+            {
+                _runs.push_back(std::move(run));
+            }
+        }
+
+        right = !right;
+    }
+}
+
+continued_fraction::tree_path::tree_path(std::vector<bool> const &path)
+        : _first_right(path.empty() || path.front())
+{
+    for (size_t i = 0; i < path.size(); ++i)
+    {
+        if (i == 0 || path[i] != path[i - 1])
+        {
+            _runs.emplace_back(0);
+        }
+
+        ++_runs.back();
+    }
+}
+
+bool continued_fraction::tree_path::first_right() const noexcept
+{
+    return _first_right;
+}
+
+std::vector<big_int> const &continued_fraction::tree_path::runs() const noexcept
+{
+    return _runs;
+}
+
+big_int continued_fraction::tree_path::length() const
+{
+    big_int result;
+    for (auto const &run : _runs)
+    {
+        result += run;
+    }
+
+    return result;
+}
+
+continued_fraction::tree_path continued_fraction::tree_path::reversed() const
+{
+    bool last_right = _first_right == (_runs.size() % 2 == 1);
+    return tree_path(std::vector<big_int>(_runs.rbegin(), _runs.rend()), _runs.empty() || last_right);
+}
+
+std::vector<bool> continued_fraction::tree_path::expand() const
+{
+    std::vector<bool> path;
+    path.reserve(expanded_size(length(), path.max_size()));
+
+    bool right = _first_right;
+    for (auto const &run : _runs)
+    {
+        path.insert(path.end(), expanded_size(run, path.max_size()), right);
+        right = !right;
+    }
+
+    return path;
+}
+
+bool continued_fraction::tree_path::operator==(tree_path const &other) const
+{
+    return _runs == other._runs && (_runs.empty() || _first_right == other._first_right);
 }
 
 std::vector<bool> continued_fraction::to_Stern_Brokot_tree_path(
     fraction const &value)
 {
-    throw not_implemented("std::vector<bool> continued_fraction::to_Stern_Brokot_tree_path(fraction const &)", "your code should be here...");
+    return to_Stern_Brokot_tree_runs(value).expand();
 }
 
 fraction continued_fraction::from_Stern_Brokot_tree_path(
     std::vector<bool> const &path)
 {
-    throw not_implemented("fraction continued_fraction::from_Stern_Brokot_tree_path(std::vector<bool> const &)", "your code should be here...");
+    return from_Stern_Brokot_tree_runs(tree_path(path));
+}
+
+continued_fraction::tree_path continued_fraction::to_Stern_Brokot_tree_runs(
+    fraction const &value)
+{
+    check_positive(value);
+
+    std::vector<big_int> runs = to_continued_fraction_representation(value);
+    --runs.back();
+
+    return tree_path(std::move(runs));
+}
+
+fraction continued_fraction::from_Stern_Brokot_tree_runs(
+    tree_path const &path)
+{
+    return from_continued_fraction_representation(Stern_Brokot_terms(path));
 }
 
 std::vector<bool> continued_fraction::to_Calkin_Wilf_tree_path(
     fraction const &value)
 {
-    throw not_implemented("std::vector<bool> continued_fraction::to_Calkin_Wilf_tree_path(fraction const &)", "your code should be here...");
+    return to_Calkin_Wilf_tree_runs(value).expand();
 }
 
 fraction continued_fraction::from_Calkin_Wilf_tree_path(
     std::vector<bool> const &path)
 {
-    throw not_implemented("fraction continued_fraction::from_Calkin_Wilf_tree_path(std::vector<bool> const &)", "your code should be here...");
-}
\ No newline at end of file
+    return from_Calkin_Wilf_tree_runs(tree_path(path));
+}
+
+continued_fraction::tree_path continued_fraction::to_Calkin_Wilf_tree_runs(
+    fraction const &value)
+{
+    // node of Calkin-Wilf tree has the reversed path of the same node of Stern-Brocot tree
+    return to_Stern_Brokot_tree_runs(value).reversed();
+}
+
+fraction continued_fraction::from_Calkin_Wilf_tree_runs(
+    tree_path const &path)
+{
+    return from_Stern_Brokot_tree_runs(path.reversed());
+}
@@ -0,0 +1,305 @@
+#include <gtest/gtest.h>
+
+#include <continued_fraction.h>
+#include <client_logger.h>
+#include <client_logger_builder.h>
+
+logger *create_logger(
+    std::vector<std::pair<std::string, logger::severity>> const &output_file_streams_setup,
+    bool use_console_stream = true,
+    logger::severity console_stream_severity = logger::severity::debug)
+{
+    logger_builder *builder = new client_logger_builder();
+
+    if (use_console_stream)
+    {
+        builder->add_console_stream(console_stream_severity);
+    }
+
+    for (auto &output_file_stream_setup: output_file_streams_setup)
+    {
+        builder->add_file_stream(output_file_stream_setup.first, output_file_stream_setup.second);
+    }
+
+    logger *built_logger = builder->build();
+
+    delete builder;
+
+    return built_logger;
+}
+TEST(continuedFractionTests, test1)
+{
+    logger *logger = create_logger(std::vector<std::pair<std::string, logger::severity>>
+        {
+            {
+                "continued_fraction_logs.txt",
+                logger::severity::information
+            },
+        });
+
+    fraction value(415_bi, 93_bi);
+    std::vector<big_int> terms{4_bi, 2_bi, 6_bi, 7_bi};
+
+    EXPECT_TRUE(continued_fraction::to_continued_fraction_representation(value) == terms);
+    EXPECT_TRUE(continued_fraction::from_continued_fraction_representation(terms) == value);
+
+    auto convergents = continued_fraction::to_convergents_series(value);
+    ASSERT_EQ(convergents.size(), 4);
+    EXPECT_TRUE(convergents[1] == fraction(9_bi, 2_bi));
+    EXPECT_TRUE(convergents[2] == fraction(58_bi, 13_bi));
+    EXPECT_TRUE(convergents == continued_fraction::to_convergents_series(terms));
+
+    // floor of a negative value is the only negative term
+    std::vector<big_int> negative_terms{-5_bi, 1_bi, 1_bi, 6_bi, 7_bi};
+    EXPECT_TRUE(continued_fraction::to_continued_fraction_representation(-value) == negative_terms);
+    EXPECT_TRUE(continued_fraction::from_continued_fraction_representation(negative_terms) == -value);
+
+    EXPECT_THROW(continued_fraction::from_continued_fraction_representation({}), std::invalid_argument);
+
+    delete logger;
+}
+
+TEST(continuedFractionTests, test2)
+{
+    logger *logger = create_logger(std::vector<std::pair<std::string, logger::severity>>
+        {
+            {
+                "continued_fraction_logs.txt",
+                logger::severity::information
+            },
+        });
+
+    // F(301) / F(300) expands into ones only, every Lehmer step has to stop exactly at quotient bounds
+    big_int previous(0), current(1);
+    for (int i = 0; i < 300; ++i)
+    {
+        previous += current;
+        std::swap(previous, current);
+    }
+
+    continued_fraction::term_generator generator(fraction(current, previous));
+    size_t count = 0;
+    while (generator.has_next())
+    {
+        big_int term = generator.next();
+        ++count;
+        EXPECT_TRUE(term == (generator.has_next() ? 1_bi : 2_bi));
+    }
+
+    EXPECT_EQ(count, 299);
+    EXPECT_TRUE(generator.convergent_numerator() == current);
+    EXPECT_TRUE(generator.convergent_denominator() == previous);
+    EXPECT_THROW(generator.next(), std::out_of_range);
+
+    fraction value(big_int("-31415926535897932384626433832795028841971693993751058209749445923"),
+                   big_int("10000000000000000000000000000000000000000000000000000000000000007"));
+
+    auto terms = continued_fraction::to_continued_fraction_representation(value);
+    EXPECT_TRUE(continued_fraction::from_continued_fraction_representation(terms) == value);
+    EXPECT_TRUE(continued_fraction::to_convergents_series(value).back() == value);
+
+    delete logger;
+}
+
+TEST(continuedFractionTests, test3)
+{
+    logger *logger = create_logger(std::vector<std::pair<std::string, logger::severity>>
+        {
+            {
+                "continued_fraction_logs.txt",
+                logger::severity::information
+            },
+        });
+
+    std::vector<bool> path{true, false, false, true, false, true};
+    fraction value(18_bi, 13_bi);
+
+    EXPECT_TRUE(continued_fraction::to_Stern_Brokot_tree_path(value) == path);
+    EXPECT_TRUE(continued_fraction::from_Stern_Brokot_tree_path(path) == value);
+
+    EXPECT_TRUE(continued_fraction::to_Calkin_Wilf_tree_path(value) == std::vector<bool>(path.rbegin(), path.rend()));
+    EXPECT_TRUE(continued_fraction::from_Calkin_Wilf_tree_path(std::vector<bool>(path.rbegin(), path.rend())) == value);
+
+    EXPECT_TRUE(continued_fraction::to_Stern_Brokot_tree_path(fraction(1_bi, 1_bi)).empty());
+    EXPECT_TRUE(continued_fraction::from_Calkin_Wilf_tree_path({}) == fraction(1_bi, 1_bi));
+    EXPECT_TRUE(continued_fraction::from_Stern_Brokot_tree_path({false, false}) == fraction(1_bi, 3_bi));
+
+    EXPECT_THROW(continued_fraction::to_Calkin_Wilf_tree_path(fraction(-1_bi, 2_bi)), std::invalid_argument);
+
+    delete logger;
+}
+
+TEST(continuedFractionTests, test4)
+{
+    logger *logger = create_logger(std::vector<std::pair<std::string, logger::severity>>
+        {
+            {
+                "continued_fraction_logs.txt",
+                logger::severity::information
+            },
+        });
+
+    fraction pi(314159265358979_bi, 100000000000000_bi);
+
+    EXPECT_TRUE(continued_fraction::best_approximation(pi, 7_bi) == fraction(22_bi, 7_bi));
+    // semiconvergent (3 + 14 * 22) / (1 + 14 * 7) is closer than convergent 22 / 7
+    EXPECT_TRUE(continued_fraction::best_approximation(pi, 100_bi) == fraction(311_bi, 99_bi));
+    EXPECT_TRUE(continued_fraction::best_approximation(pi, 1000_bi) == fraction(355_bi, 113_bi));
+    EXPECT_TRUE(continued_fraction::best_approximation(-pi, 1000_bi) == fraction(-355_bi, 113_bi));
+    EXPECT_TRUE(continued_fraction::best_approximation(fraction(3_bi, 8_bi), 8_bi) == fraction(3_bi, 8_bi));
+    EXPECT_THROW(continued_fraction::best_approximation(pi, 0_bi), std::invalid_argument);
+
+    interval bounds(fraction(314_bi, 100_bi), fraction(315_bi, 100_bi));
+    EXPECT_TRUE(continued_fraction::best_approximation(bounds, 1000_bi) == fraction(22_bi, 7_bi));
+    EXPECT_TRUE(continued_fraction::best_approximation(-bounds, 1000_bi) == fraction(-22_bi, 7_bi));
+    EXPECT_TRUE(continued_fraction::best_approximation(interval(fraction(-1_bi, 2_bi), fraction(1_bi, 5_bi)), 1_bi) == fraction(0_bi, 1_bi));
+    EXPECT_TRUE(continued_fraction::best_approximation(interval(fraction(7_bi, 2_bi), fraction(4_bi, 1_bi)), 1_bi) == fraction(4_bi, 1_bi));
+    EXPECT_THROW(continued_fraction::best_approximation(bounds, 6_bi), std::domain_error);
+
+    delete logger;
+}
+
+TEST(continuedFractionTests, test5)
+{
+    logger *logger = create_logger(std::vector<std::pair<std::string, logger::severity>>
+        {
+            {
+                "continued_fraction_logs.txt",
+                logger::severity::information
+            },
+        });
+
+    auto sqrt2 = []()
+    {
+        return continued_fraction::term_stream([first = true]() mutable -> std::optional<big_int>
+        {
+            return std::exchange(first, false) ? 1_bi : 2_bi;
+        });
+    };
+
+    auto take = [](continued_fraction::term_stream stream, size_t count)
+    {
+        std::vector<big_int> result;
+        for (std::optional<big_int> term; result.size() < count && (term = stream());)
+        {
+            result.push_back(std::move(*term));
+        }
+
+        return result;
+    };
+
+    // 2 * sqrt(2) = [2; 1, 4, 1, 4, ...], (sqrt(2) + 1) / (sqrt(2) - 1) = [5; 1, 4, 1, 4, ...]
+    std::vector<big_int> doubled{2_bi, 1_bi, 4_bi, 1_bi, 4_bi, 1_bi, 4_bi, 1_bi};
+    std::vector<big_int> transformed{5_bi, 1_bi, 4_bi, 1_bi, 4_bi, 1_bi, 4_bi, 1_bi};
+    EXPECT_TRUE(take(continued_fraction::sum(sqrt2(), sqrt2()), 8) == doubled);
+    EXPECT_TRUE(take(continued_fraction::mobius(sqrt2(), 1_bi, 1_bi, 1_bi, -1_bi), 8) == transformed);
+
+    fraction x(415_bi, 93_bi), y(-17_bi, 5_bi);
+    auto representation = [](fraction const &value)
+    {
+        return continued_fraction::to_continued_fraction_representation(value);
+    };
+
+    EXPECT_TRUE(take(continued_fraction::sum(continued_fraction::terms(x), continued_fraction::terms(y)), 100) == representation(x + y));
+    EXPECT_TRUE(take(continued_fraction::difference(continued_fraction::terms(x), continued_fraction::terms(y)), 100) == representation(x - y));
+    EXPECT_TRUE(take(continued_fraction::product(continued_fraction::terms(x), continued_fraction::terms(y)), 100) == representation(x * y));
+    EXPECT_TRUE(take(continued_fraction::quotient(continued_fraction::terms(x), continued_fraction::terms(representation(y))), 100) == representation(x / y));
+
+    // division by zero is infinity, which has no terms
+    EXPECT_TRUE(take(continued_fraction::quotient(continued_fraction::terms(x), continued_fraction::terms(fraction(0_bi, 1_bi))), 100).empty());
+
+    delete logger;
+}
+
+TEST(continuedFractionTests, test6)
+{
+    logger *logger = create_logger(std::vector<std::pair<std::string, logger::severity>>
+        {
+            {
+                "continued_fraction_logs.txt",
+                logger::severity::information
+            },
+        });
+
+    // [1; 2, 1, 1, 2] is R LL R L R
+    fraction value(18_bi, 13_bi);
+    continued_fraction::tree_path runs = continued_fraction::to_Stern_Brokot_tree_runs(value);
+
+    EXPECT_TRUE(runs == continued_fraction::tree_path({1_bi, 2_bi, 1_bi, 1_bi, 1_bi}));
+    EXPECT_TRUE(runs == continued_fraction::tree_path(continued_fraction::to_Stern_Brokot_tree_path(value)));
+    EXPECT_TRUE(runs.expand() == continued_fraction::to_Stern_Brokot_tree_path(value));
+    EXPECT_TRUE(continued_fraction::from_Stern_Brokot_tree_runs(runs) == value);
+    EXPECT_TRUE(continued_fraction::to_Calkin_Wilf_tree_runs(value) == runs.reversed());
+    EXPECT_TRUE(continued_fraction::from_Calkin_Wilf_tree_runs(runs.reversed()) == value);
+
+    // zero runs only switch direction
+    continued_fraction::tree_path merged({0_bi, 2_bi, 0_bi, 3_bi, 1_bi});
+    EXPECT_FALSE(merged.first_right());
+    EXPECT_TRUE(merged.runs() == std::vector<big_int>({5_bi, 1_bi}));
+    EXPECT_TRUE(continued_fraction::from_Stern_Brokot_tree_runs(merged) == fraction(2_bi, 11_bi));
+
+    // 10^30 steps to the right are never expanded
+    big_int huge = 1_bi;
+    for (int i = 0; i < 30; ++i)
+    {
+        huge *= 10_bi;
+    }
+
+    continued_fraction::tree_path long_path = continued_fraction::to_Calkin_Wilf_tree_runs(fraction(huge, 1_bi));
+    EXPECT_TRUE(long_path.length() == huge - 1_bi);
+    EXPECT_TRUE(continued_fraction::from_Calkin_Wilf_tree_runs(long_path) == fraction(huge, 1_bi));
+    EXPECT_THROW(long_path.expand(), std::length_error);
+    EXPECT_THROW(continued_fraction::tree_path({-1_bi}), std::invalid_argument);
+
+    delete logger;
+}
+
+TEST(continuedFractionTests, test7)
+{
+    logger *logger = create_logger(std::vector<std::pair<std::string, logger::severity>>
+        {
+            {
+                "continued_fraction_logs.txt",
+                logger::severity::information
+            },
+        });
+
+    // long enough for product tree to split across threads, checked against the term generator
+    std::vector<big_int> terms;
+    for (size_t i = 0; i < 10000; ++i)
+    {
+        terms.emplace_back(static_cast<unsigned int>(i % 97 + 1));
+    }
+    terms.front() = -3_bi;
+    terms.back() = 2_bi;
+
+    fraction value = continued_fraction::from_continued_fraction_representation(terms);
+    EXPECT_TRUE(continued_fraction::to_continued_fraction_representation(value) == terms);
+
+    auto convergents = continued_fraction::to_convergents_series(terms);
+    ASSERT_EQ(convergents.size(), terms.size());
+    EXPECT_TRUE(convergents.back() == value);
+
+    continued_fraction::term_generator generator(value);
+    EXPECT_THROW(static_cast<void>(generator.convergent()), std::out_of_range);
+
+    for (auto const &convergent : convergents)
+    {
+        generator.next();
+        EXPECT_TRUE(convergent.numerator() == generator.convergent_numerator());
+        EXPECT_TRUE(convergent.denominator() == generator.convergent_denominator());
+    }
+
+    EXPECT_THROW(continued_fraction::to_convergents_series(std::vector<big_int>{1_bi, 0_bi}), std::invalid_argument);
+
+    delete logger;
+}
+
+int main(
+    int argc,
+    char **argv)
+{
+    testing::InitGoogleTest(&argc, argv);
+
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,36 @@
+#ifndef MP_OS_BATCH_EVAL_H
+#define MP_OS_BATCH_EVAL_H
+
+#include <functional>
+#include <span>
+#include <vector>
+#include <fraction.h>
+
+/** Function evaluated at one point with given epsilon
+ */
+using batch_function = std::function<fraction(fraction const &value, fraction const &epsilon)>;
+
+using batch_member_function = fraction (fraction::*)(fraction const &, fraction::evaluation_mode) const;
+
+/** Evaluates function at every value on threads workers, hardware concurrency if threads is 0.
+ *  Workers take chunks of indices from a shared counter, so items of uneven cost are balanced,
+ *  and move results into preallocated slots. pi, ln 2 and ln 10 are cached with spare precision
+ *  before workers start, so workers only take shared read locks on the constant caches.
+ *  First exception thrown by function stops remaining work and is rethrown
+ */
+std::vector<fraction> batch_eval(
+        batch_function const &function,
+        std::span<const fraction> values,
+        fraction const &epsilon,
+        size_t threads = 0);
+
+/** Overload for fraction::sin, fraction::ln and other functions of epsilon and evaluation mode
+ */
+std::vector<fraction> batch_eval(
+        batch_member_function function,
+        std::span<const fraction> values,
+        fraction const &epsilon,
+        size_t threads = 0,
+        fraction::evaluation_mode mode = fraction::evaluation_mode::exact);
+
+#endif //MP_OS_BATCH_EVAL_H
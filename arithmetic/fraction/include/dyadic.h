@@ -0,0 +1,87 @@
+#ifndef MP_OS_DYADIC_H
+#define MP_OS_DYADIC_H
+
+#include <big_int.h>
+#include <fraction.h>
+
+/** Rational mantissa * 2^exponent. Mantissa is kept odd (or zero with zero exponent),
+ *  so every value has one representation and no gcd is ever needed:
+ *  sum, difference and product are exact, scaling by powers of two only moves exponent
+ */
+class dyadic final
+{
+
+private:
+
+    big_int _mantissa;
+    long long _exponent;
+
+    void normalize();
+
+public:
+
+    dyadic(big_int mantissa = 0_bi, long long exponent = 0);
+
+    /** @throw std::invalid_argument if denominator of value is not a power of two
+     */
+    explicit dyadic(fraction const &value);
+
+    /** value * 2^bits rounded down, divided back by 2^bits
+     */
+    static dyadic approximate(fraction const &value, size_t bits);
+
+public:
+
+    big_int const &mantissa() const noexcept;
+
+    long long exponent() const noexcept;
+
+    bool is_zero() const noexcept;
+
+    fraction to_fraction() const;
+
+    /** Rounds down to bits after binary point
+     */
+    dyadic &truncate(size_t bits) &;
+
+public:
+
+    dyadic &operator+=(dyadic const &other) &;
+
+    dyadic operator+(dyadic const &other) const;
+
+    dyadic &operator-=(dyadic const &other) &;
+
+    dyadic operator-(dyadic const &other) const;
+
+    dyadic &operator*=(dyadic const &other) &;
+
+    dyadic operator*(dyadic const &other) const;
+
+    dyadic operator-() const;
+
+    /** Multiplication by 2^shift
+     */
+    dyadic &operator<<=(size_t shift) &;
+
+    dyadic operator<<(size_t shift) const;
+
+    /** Exact division by 2^shift
+     */
+    dyadic &operator>>=(size_t shift) &;
+
+    dyadic operator>>(size_t shift) const;
+
+public:
+
+    bool operator==(dyadic const &other) const noexcept;
+
+    std::strong_ordering operator<=>(dyadic const &other) const noexcept;
+
+public:
+
+    friend std::ostream &operator<<(std::ostream &stream, dyadic const &obj);
+
+};
+
+#endif //MP_OS_DYADIC_H
@@ -8,13 +8,71 @@
 class fraction final
 {
 
+public:
+
+    /** eager: every operation ends with full gcd reduction
+     *  deferred: operations only strip common powers of two and small primes,
+     *  full reduction happens when operands grow twice since the last one.
+     *  Result of an operation keeps the mode of its left operand
+     */
+    enum class normalization_mode
+    {
+        eager,
+        deferred
+    };
+
+    /** exact: functions work on exact rationals and return them
+     *  fixed_point: functions work on big_int scaled by 2^(bits of epsilon + guard bits),
+     *  so operand size is bounded by precision; result denominator is a power of two
+     */
+    enum class evaluation_mode
+    {
+        exact,
+        fixed_point
+    };
+
 private:
 
     big_int _numerator;
     big_int _denominator;
 
+    normalization_mode _mode = normalization_mode::eager;
+    bool _reduced = true;
+    size_t _reduced_bits = 0;
+
     void optimise(); //сокращает дробь
 
+    void reduce_cheap();
+
+    void reduce_full();
+
+    void mark_reduced();
+
+    /** Henrici addition for reduced operands, plain cross multiplication otherwise
+     */
+    fraction &plus_assign(fraction const &other, bool subtract) &;
+
+    /** Number of bits after binary point needed to reach epsilon
+     */
+    static size_t precision_bits(fraction const &epsilon);
+
+    /** Cached constants truncated to bits after binary point, error is below 2^-bits
+     */
+    static fraction pi_to_bits(size_t bits);
+
+    static fraction ln2_to_bits(size_t bits);
+
+    static fraction ln10_to_bits(size_t bits);
+
+    /** Reduces value by k * pi / 2 with nearest integer k, so the result lies in [-pi / 4, pi / 4]
+     *  up to 2^-bits; returns k mod 4
+     */
+    size_t reduce_argument(size_t bits, fraction &reduced) const;
+
+    fraction sin_series(size_t bits, evaluation_mode mode) const;
+
+    fraction cos_series(size_t bits, evaluation_mode mode) const;
+
 public:
 
     /** Perfect forwarding ctor
@@ -31,6 +89,31 @@ public:
 
     fraction(pp_allocator<big_int::value_type> = pp_allocator<big_int::value_type>());
 
+public:
+
+    /** Switching to eager mode reduces the fraction immediately
+     */
+    fraction &set_normalization_mode(normalization_mode mode) &;
+
+    normalization_mode get_normalization_mode() const noexcept;
+
+    /** Current terms, denominator is positive; in deferred mode they may share a common factor
+     */
+    big_int const &numerator() const noexcept;
+
+    big_int const &denominator() const noexcept;
+
+    fraction &normalize() &;
+
+    /** value / 2^bits, only common powers of two are cancelled
+     */
+    static fraction from_fixed_point(big_int value, size_t bits);
+
+    /** numerator / denominator for terms known to be coprime, e.g. convergents; only the sign is normalized
+     *  @throw std::invalid_argument if denominator is zero
+     */
+    static fraction from_coprime(big_int numerator, big_int denominator);
+
 public:
 
     fraction &operator+=(fraction const &other) &;
@@ -65,31 +148,41 @@ public:
 
     std::string to_string() const;
 
+    /** Correctly rounded (to nearest, ties to even) value, built from a 63-bit quotient
+     *  of leading limbs and a sticky bit of the remainder
+     */
+    double to_double() const;
+
+    /** Writes value truncated to digits decimals, fractional digits are produced
+     *  in chunks of nine by multiplying remainder by 10^9 and dividing by denominator
+     */
+    std::ostream &to_decimal(std::ostream &stream, size_t digits) const;
+
 public:
 
-    fraction sin(fraction const &epsilon = fraction(1_bi, 1000000_bi)) const;
+    fraction sin(fraction const &epsilon = fraction(1_bi, 1000000_bi), evaluation_mode mode = evaluation_mode::exact) const;
 
-    fraction cos(fraction const &epsilon = fraction(1_bi, 1000000_bi)) const;
+    fraction cos(fraction const &epsilon = fraction(1_bi, 1000000_bi), evaluation_mode mode = evaluation_mode::exact) const;
 
-    fraction tg(fraction const &epsilon = fraction(1_bi, 1000000_bi)) const;
+    fraction tg(fraction const &epsilon = fraction(1_bi, 1000000_bi), evaluation_mode mode = evaluation_mode::exact) const;
 
-    fraction ctg(fraction const &epsilon = fraction(1_bi, 1000000_bi)) const;
+    fraction ctg(fraction const &epsilon = fraction(1_bi, 1000000_bi), evaluation_mode mode = evaluation_mode::exact) const;
 
-    fraction sec(fraction const &epsilon = fraction(1_bi, 1000000_bi)) const;
+    fraction sec(fraction const &epsilon = fraction(1_bi, 1000000_bi), evaluation_mode mode = evaluation_mode::exact) const;
 
-    fraction cosec(fraction const &epsilon = fraction(1_bi, 1000000_bi)) const;
+    fraction cosec(fraction const &epsilon = fraction(1_bi, 1000000_bi), evaluation_mode mode = evaluation_mode::exact) const;
 
-    fraction arcsin(fraction const &epsilon = fraction(1_bi, 1000000_bi)) const;
+    fraction arcsin(fraction const &epsilon = fraction(1_bi, 1000000_bi), evaluation_mode mode = evaluation_mode::exact) const;
 
-    fraction arccos(fraction const &epsilon = fraction(1_bi, 1000000_bi)) const;
+    fraction arccos(fraction const &epsilon = fraction(1_bi, 1000000_bi), evaluation_mode mode = evaluation_mode::exact) const;
 
-    fraction arctg(fraction const &epsilon = fraction(1_bi, 1000000_bi)) const;
+    fraction arctg(fraction const &epsilon = fraction(1_bi, 1000000_bi), evaluation_mode mode = evaluation_mode::exact) const;
 
-    fraction arcctg(fraction const &epsilon = fraction(1_bi, 1000000_bi)) const;
+    fraction arcctg(fraction const &epsilon = fraction(1_bi, 1000000_bi), evaluation_mode mode = evaluation_mode::exact) const;
 
-    fraction arcsec(fraction const &epsilon = fraction(1_bi, 1000000_bi)) const;
+    fraction arcsec(fraction const &epsilon = fraction(1_bi, 1000000_bi), evaluation_mode mode = evaluation_mode::exact) const;
 
-    fraction arccosec(fraction const &epsilon = fraction(1_bi, 1000000_bi)) const;
+    fraction arccosec(fraction const &epsilon = fraction(1_bi, 1000000_bi), evaluation_mode mode = evaluation_mode::exact) const;
 
 public:
 
@@ -97,21 +190,35 @@ public:
 
 public:
 
-    fraction root(size_t degree, fraction const &epsilon = fraction(1_bi, 1000000_bi)) const;
+    fraction root(size_t degree, fraction const &epsilon = fraction(1_bi, 1000000_bi), evaluation_mode mode = evaluation_mode::exact) const;
 
 public:
 
-    fraction log2(fraction const &epsilon = fraction(1_bi, 1000000_bi)) const;
+    fraction log2(fraction const &epsilon = fraction(1_bi, 1000000_bi), evaluation_mode mode = evaluation_mode::exact) const;
 
-    fraction ln(fraction const &epsilon = fraction(1_bi, 1000000_bi)) const;
+    fraction ln(fraction const &epsilon = fraction(1_bi, 1000000_bi), evaluation_mode mode = evaluation_mode::exact) const;
 
-    fraction lg(fraction const &epsilon = fraction(1_bi, 1000000_bi)) const;
+    fraction lg(fraction const &epsilon = fraction(1_bi, 1000000_bi), evaluation_mode mode = evaluation_mode::exact) const;
 
     fraction abs() const;
 
     static fraction calculate_half_pi(const fraction &epsilon) ;
 
-    static fraction ln_normalized(const fraction &x, const fraction &epsilon) ;
+public:
+
+    /** Process-wide constants keyed by precision: a request for more bits than cached
+     *  recomputes the constant with at least one and a half times the cached precision,
+     *  a request for fewer bits truncates the cached value
+     */
+    static fraction pi(fraction const &epsilon = fraction(1_bi, 1000000_bi));
+
+    static fraction ln2(fraction const &epsilon = fraction(1_bi, 1000000_bi));
+
+    static fraction ln10(fraction const &epsilon = fraction(1_bi, 1000000_bi));
+
+public:
+
+    static fraction ln_normalized(const fraction &x, const fraction &epsilon, evaluation_mode mode = evaluation_mode::exact) ;
 };
 
 #endif //MP_OS_FRACTION_H
\ No newline at end of file
@@ -0,0 +1,72 @@
+#ifndef MP_OS_HYPERGEOMETRIC_SERIES_H
+#define MP_OS_HYPERGEOMETRIC_SERIES_H
+
+#include <functional>
+#include <big_int.h>
+#include <fraction.h>
+
+/** Series sum_{n >= 0} a(n) / b(n) * prod_{k = 0}^{n} p(k) / q(k) evaluated by binary splitting:
+ *  partial products are combined pairwise, so the big multiplications happen at the top
+ *  of the recursion and the only gcd is the one of the final fraction.
+ */
+class hypergeometric_series final
+{
+
+public:
+
+    using coefficient = std::function<big_int(size_t)>;
+
+    /** Sum of terms [from, to) equals T / (B * Q), P is the product of p over the range
+     */
+    struct partial_sum
+    {
+        big_int P;
+        big_int Q;
+        big_int B;
+        big_int T;
+    };
+
+private:
+
+    coefficient _p;
+    coefficient _q;
+    coefficient _a;
+    coefficient _b;
+
+public:
+
+    /** a and b default to 1
+     */
+    hypergeometric_series(coefficient p, coefficient q, coefficient a = nullptr, coefficient b = nullptr);
+
+public:
+
+    /** Smallest count of terms after which terms decrease and the next one is below 2^-precision_bits.
+     *  Estimated from leading limbs of coefficients, no big arithmetic is done.
+     *  Throws std::domain_error if more than 2^22 terms would be needed
+     */
+    size_t terms_count(size_t precision_bits) const;
+
+    fraction sum(size_t terms) const;
+
+    /** Sum with absolute error below 2^-precision_bits for alternating or geometrically decreasing tails
+     */
+    fraction sum_to_precision(size_t precision_bits) const;
+
+    /** Same sum evaluated term by term on integers scaled by 2^(precision_bits + guard bits),
+     *  so no operand outgrows the requested precision. Truncation of every term is covered
+     *  by guard bits while terms do not grow; result denominator is 2^(precision_bits + 1)
+     */
+    fraction sum_fixed_point(size_t precision_bits) const;
+
+    partial_sum split(size_t from, size_t to) const;
+
+private:
+
+    big_int a(size_t n) const;
+
+    big_int b(size_t n) const;
+
+};
+
+#endif //MP_OS_HYPERGEOMETRIC_SERIES_H
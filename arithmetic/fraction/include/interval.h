@@ -0,0 +1,117 @@
+#ifndef MP_OS_INTERVAL_H
+#define MP_OS_INTERVAL_H
+
+#include <functional>
+#include <fraction.h>
+
+/** Closed interval [lower, upper] certainly containing some real value.
+ *  Endpoints wider than precision bits after binary point are rounded outward to dyadic
+ *  fractions, so their size stays bounded however long the computation is.
+ */
+class interval final
+{
+
+public:
+
+    static constexpr size_t DEFAULT_PRECISION = 64;
+
+    /** Computation of an enclosure with endpoints rounded to given precision
+     */
+    using evaluator = std::function<interval(size_t precision)>;
+
+private:
+
+    fraction _lower;
+    fraction _upper;
+    size_t _precision;
+
+public:
+
+    explicit interval(fraction const &value, size_t precision = DEFAULT_PRECISION);
+
+    /** @throw std::invalid_argument if lower > upper
+     */
+    interval(fraction const &lower, fraction const &upper, size_t precision = DEFAULT_PRECISION);
+
+public:
+
+    fraction const &lower() const noexcept;
+
+    fraction const &upper() const noexcept;
+
+    size_t precision() const noexcept;
+
+    fraction width() const;
+
+    bool contains(fraction const &value) const;
+
+public:
+
+    interval &operator+=(interval const &other) &;
+
+    interval operator+(interval const &other) const;
+
+    interval &operator-=(interval const &other) &;
+
+    interval operator-(interval const &other) const;
+
+    interval &operator*=(interval const &other) &;
+
+    interval operator*(interval const &other) const;
+
+    /** @throw std::domain_error if other contains zero
+     */
+    interval &operator/=(interval const &other) &;
+
+    interval operator/(interval const &other) const;
+
+    interval operator-() const;
+
+public:
+
+    /** less or greater only if enclosures are disjoint, equivalent only for equal points,
+     *  unordered when enclosures overlap and the order is undecided
+     */
+    std::partial_ordering operator<=>(interval const &other) const;
+
+    /** Evaluates both sides starting from initial_precision and doubles precision
+     *  while enclosures overlap; unordered if max_precision did not decide the order
+     */
+    static std::partial_ordering compare(evaluator const &lhs, evaluator const &rhs,
+                                         size_t initial_precision = DEFAULT_PRECISION,
+                                         size_t max_precision = 64 * DEFAULT_PRECISION);
+
+public:
+
+    interval sin() const;
+
+    /** Endpoint values are widened by evaluation error; if interval contains a multiple of pi,
+     *  corresponding extremum is included
+     */
+    interval cos() const;
+
+    /** @throw std::domain_error if interval is not strictly positive
+     */
+    interval ln() const;
+
+    /** @throw std::domain_error if degree is even and interval contains negative values
+     */
+    interval root(size_t degree) const;
+
+public:
+
+    friend std::ostream &operator<<(std::ostream &stream, interval const &obj);
+
+private:
+
+    /** Error bound of a single function evaluation at current precision
+     */
+    fraction evaluation_error() const;
+
+    interval &round_outward() &;
+
+    static interval pi_enclosure(size_t precision);
+
+};
+
+#endif //MP_OS_INTERVAL_H
@@ -0,0 +1,97 @@
+#include "../include/batch_eval.h"
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <mutex>
+#include <thread>
+
+namespace
+{
+    /** Chunks per worker: small enough to balance uneven items, large enough to keep the counter cold
+     */
+    constexpr size_t CHUNKS_PER_WORKER = 16;
+
+    /** Argument reduction and logarithm scaling ask constants for more bits than epsilon has
+     */
+    constexpr size_t CONSTANT_SPARE_BITS = 64;
+}
+
+std::vector<fraction> batch_eval(
+        batch_function const &function,
+        std::span<const fraction> values,
+        fraction const &epsilon,
+        size_t threads)
+{
+    std::vector<fraction> results(values.size());
+    if (values.empty()) {
+        return results;
+    }
+
+    fraction constants_epsilon = epsilon / fraction(1_bi << CONSTANT_SPARE_BITS, 1_bi);
+    fraction::pi(constants_epsilon);
+    fraction::ln2(constants_epsilon);
+    fraction::ln10(constants_epsilon);
+
+    if (threads == 0) {
+        threads = std::max(1u, std::thread::hardware_concurrency());
+    }
+    const size_t chunk = std::max<size_t>(1, values.size() / (threads * CHUNKS_PER_WORKER));
+    threads = std::min(threads, (values.size() + chunk - 1) / chunk);
+
+    std::atomic<size_t> next{0};
+    std::atomic<bool> failed{false};
+    std::exception_ptr failure;
+    std::mutex failure_mutex;
+
+    auto worker = [&]() {
+        while (!failed.load(std::memory_order_relaxed)) {
+            size_t from = next.fetch_add(chunk, std::memory_order_relaxed);
+            if (from >= values.size()) {
+                return;
+            }
+
+            size_t to = std::min(from + chunk, values.size());
+            try {
+                for (size_t i = from; i < to; ++i) {
+                    results[i] = function(values[i], epsilon);
+                }
+            } catch (...) {
+                std::lock_guard<std::mutex> lock(failure_mutex);
+                if (!failure) {
+                    failure = std::current_exception();
+                }
+                failed.store(true, std::memory_order_relaxed);
+                return;
+            }
+        }
+    };
+
+    {
+        std::vector<std::jthread> workers;
+        workers.reserve(threads - 1);
+        for (size_t i = 1; i < threads; ++i) {
+            workers.emplace_back(worker);
+        }
+        worker();
+    }
+
+    if (failure) {
+        std::rethrow_exception(failure);
+    }
+
+    return results;
+}
+
+std::vector<fraction> batch_eval(
+        batch_member_function function,
+        std::span<const fraction> values,
+        fraction const &epsilon,
+        size_t threads,
+        fraction::evaluation_mode mode)
+{
+    return batch_eval(
+            [function, mode](fraction const &value, fraction const &precision) {
+                return (value.*function)(precision, mode);
+            },
+            values, epsilon, threads);
+}
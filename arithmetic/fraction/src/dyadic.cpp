@@ -0,0 +1,215 @@
+#include "../include/dyadic.h"
+#include <stdexcept>
+
+dyadic::dyadic(big_int mantissa, long long exponent)
+        : _mantissa(std::move(mantissa)), _exponent(exponent)
+{
+    normalize();
+}
+
+dyadic::dyadic(fraction const &value)
+        : _mantissa(value.numerator()), _exponent(0)
+{
+    big_int const &denominator = value.denominator();
+    size_t twos = denominator.trailing_zero_bits();
+
+    if (denominator.bit_length() != twos + 1) {
+        throw std::invalid_argument("Denominator is not a power of two");
+    }
+
+    _exponent = -static_cast<long long>(twos);
+    normalize();
+}
+
+dyadic dyadic::approximate(fraction const &value, size_t bits)
+{
+    big_int scaled = value.numerator() << bits;
+    big_int quotient = scaled / value.denominator();
+
+    if (scaled.is_negative() && !(scaled - quotient * value.denominator()).is_zero()) {
+        --quotient;
+    }
+
+    return dyadic(std::move(quotient), -static_cast<long long>(bits));
+}
+
+void dyadic::normalize()
+{
+    if (_mantissa.is_zero()) {
+        _exponent = 0;
+        return;
+    }
+
+    size_t twos = _mantissa.trailing_zero_bits();
+    if (twos > 0) {
+        _mantissa >>= twos;
+        _exponent += static_cast<long long>(twos);
+    }
+}
+
+big_int const &dyadic::mantissa() const noexcept
+{
+    return _mantissa;
+}
+
+long long dyadic::exponent() const noexcept
+{
+    return _exponent;
+}
+
+bool dyadic::is_zero() const noexcept
+{
+    return _mantissa.is_zero();
+}
+
+fraction dyadic::to_fraction() const
+{
+    if (_exponent >= 0) {
+        return fraction(_mantissa << static_cast<size_t>(_exponent), 1_bi);
+    }
+
+    return fraction::from_fixed_point(_mantissa, static_cast<size_t>(-_exponent));
+}
+
+dyadic &dyadic::truncate(size_t bits) &
+{
+    auto lowest = -static_cast<long long>(bits);
+    if (_exponent >= lowest) {
+        return *this;
+    }
+
+    // arithmetic shift rounds towards zero, negative values need one more step down
+    auto dropped = static_cast<size_t>(lowest - _exponent);
+    bool negative = _mantissa.is_negative();
+    _mantissa >>= dropped;
+    if (negative) {
+        --_mantissa;
+    }
+    _exponent = lowest;
+
+    normalize();
+    return *this;
+}
+
+dyadic &dyadic::operator+=(dyadic const &other) &
+{
+    if (other.is_zero()) {
+        return *this;
+    }
+    if (is_zero()) {
+        return *this = other;
+    }
+
+    if (_exponent > other._exponent) {
+        _mantissa <<= static_cast<size_t>(_exponent - other._exponent);
+        _exponent = other._exponent;
+        _mantissa += other._mantissa;
+    } else {
+        _mantissa += other._mantissa << static_cast<size_t>(other._exponent - _exponent);
+    }
+
+    normalize();
+    return *this;
+}
+
+dyadic dyadic::operator+(dyadic const &other) const
+{
+    dyadic result = *this;
+    result += other;
+    return result;
+}
+
+dyadic &dyadic::operator-=(dyadic const &other) &
+{
+    return *this += -other;
+}
+
+dyadic dyadic::operator-(dyadic const &other) const
+{
+    dyadic result = *this;
+    result -= other;
+    return result;
+}
+
+dyadic &dyadic::operator*=(dyadic const &other) &
+{
+    // product of odd mantissas is odd, no normalization is needed
+    _mantissa *= other._mantissa;
+    _exponent = _mantissa.is_zero() ? 0 : _exponent + other._exponent;
+    return *this;
+}
+
+dyadic dyadic::operator*(dyadic const &other) const
+{
+    dyadic result = *this;
+    result *= other;
+    return result;
+}
+
+dyadic dyadic::operator-() const
+{
+    dyadic result = *this;
+    result._mantissa = -result._mantissa;
+    return result;
+}
+
+dyadic &dyadic::operator<<=(size_t shift) &
+{
+    if (!is_zero()) {
+        _exponent += static_cast<long long>(shift);
+    }
+    return *this;
+}
+
+dyadic dyadic::operator<<(size_t shift) const
+{
+    dyadic result = *this;
+    result <<= shift;
+    return result;
+}
+
+dyadic &dyadic::operator>>=(size_t shift) &
+{
+    if (!is_zero()) {
+        _exponent -= static_cast<long long>(shift);
+    }
+    return *this;
+}
+
+dyadic dyadic::operator>>(size_t shift) const
+{
+    dyadic result = *this;
+    result >>= shift;
+    return result;
+}
+
+bool dyadic::operator==(dyadic const &other) const noexcept
+{
+    return _exponent == other._exponent && _mantissa == other._mantissa;
+}
+
+std::strong_ordering dyadic::operator<=>(dyadic const &other) const noexcept
+{
+    int sign = _mantissa.is_zero() ? 0 : (_mantissa.is_negative() ? -1 : 1);
+    int other_sign = other._mantissa.is_zero() ? 0 : (other._mantissa.is_negative() ? -1 : 1);
+    if (sign != other_sign || sign == 0) {
+        return sign <=> other_sign;
+    }
+
+    // |x| lies in [2^(top - 1), 2^top), different tops decide without aligning mantissas
+    long long top = static_cast<long long>(_mantissa.bit_length()) + _exponent;
+    long long other_top = static_cast<long long>(other._mantissa.bit_length()) + other._exponent;
+    if (top != other_top) {
+        return sign > 0 ? top <=> other_top : other_top <=> top;
+    }
+
+    if (_exponent > other._exponent) {
+        return (_mantissa << static_cast<size_t>(_exponent - other._exponent)) <=> other._mantissa;
+    }
+    return _mantissa <=> (other._mantissa << static_cast<size_t>(other._exponent - _exponent));
+}
+
+std::ostream &operator<<(std::ostream &stream, dyadic const &obj)
+{
+    return stream << obj.to_fraction();
+}
@@ -1,36 +1,233 @@
 #include "../include/fraction.h"
+#include "../include/hypergeometric_series.h"
 #include <cmath>
+#include <cstdio>
 #include <numeric>
 #include <sstream>
 #include <regex>
+#include <algorithm>
+#include <mutex>
+#include <shared_mutex>
+#include <bit>
+
+namespace
+{
+    constexpr size_t DEFERRED_REDUCTION_SLACK = 256;
+    constexpr size_t FIXED_POINT_GUARD_BITS = 2;
+    constexpr size_t CONSTANT_GUARD_BITS = 8;
+    constexpr size_t REDUCTION_ESTIMATE_BITS = 64;
+
+    /** Constant stored as floor(value * 2^bits)
+     */
+    struct constant_cache
+    {
+        std::shared_mutex mutex;
+        big_int value;
+        size_t bits = 0;
+    };
+
+    /** Requests covered by the cache only take a shared lock, so concurrent readers do not serialize;
+     *  extension takes the exclusive lock and checks precision again
+     */
+    template<typename evaluator>
+    fraction cached_constant(constant_cache &cache, size_t bits, evaluator &&evaluate)
+    {
+        {
+            std::shared_lock<std::shared_mutex> lock(cache.mutex);
+
+            if (cache.bits >= bits) {
+                return fraction::from_fixed_point(cache.value >> (cache.bits - bits), bits);
+            }
+        }
+
+        std::lock_guard<std::shared_mutex> lock(cache.mutex);
+
+        if (cache.bits < bits) {
+            size_t extended = std::max(bits, cache.bits + cache.bits / 2);
+            cache.value = evaluate(extended);
+            cache.bits = extended;
+        }
+
+        return fraction::from_fixed_point(cache.value >> (cache.bits - bits), bits);
+    }
+
+    /** arctg(1 / k), or artanh(1 / k) if hyperbolic, with error below 2^-bits
+     */
+    fraction inverse_arctg(unsigned int k, size_t bits, bool hyperbolic)
+    {
+        big_int k_bi(k);
+        big_int k_squared(static_cast<unsigned long long>(k) * k);
+
+        hypergeometric_series series(
+                [hyperbolic](size_t n) { return n == 0 || hyperbolic ? 1_bi : -1_bi; },
+                [k_bi, k_squared](size_t n) { return n == 0 ? k_bi : k_squared; },
+                nullptr,
+                [](size_t n) { return big_int(2 * n + 1); });
+
+        return series.sum_fixed_point(bits);
+    }
+
+    /** floor(value^(1/degree)) for non-negative value, Newton iteration from above
+     */
+    big_int integer_root(big_int const &value, size_t degree)
+    {
+        if (value.is_zero()) {
+            return value;
+        }
+
+        big_int current = 1_bi << ((value.bit_length() + degree - 1) / degree);
+        big_int degree_minus_one(degree - 1);
+        big_int degree_bi(degree);
+
+        while (true) {
+            big_int power = 1_bi;
+            for (size_t i = 1; i < degree; ++i) {
+                power *= current;
+            }
+
+            big_int next = current * degree_minus_one + value / power;
+            next /= degree_bi;
+
+            if (next >= current) {
+                return current;
+            }
+            current = std::move(next);
+        }
+    }
+}
 
 void fraction::optimise()
 {
-    if (_denominator < 0_bi) {
+    if (_denominator.is_negative()) {
         _numerator = -_numerator;
         _numerator.optimize();
         _denominator = -_denominator;
     }
 
+    if (_mode == normalization_mode::deferred) {
+        reduce_cheap();
+
+        if (_numerator.bit_length() + _denominator.bit_length() <= 2 * _reduced_bits + DEFERRED_REDUCTION_SLACK) {
+            return;
+        }
+    }
+
+    reduce_full();
+}
+
+void fraction::reduce_cheap()
+{
+    if (_numerator.is_zero()) {
+        _denominator = 1_bi;
+        _reduced = true;
+        return;
+    }
+
+    size_t common_twos = std::min(_numerator.trailing_zero_bits(), _denominator.trailing_zero_bits());
+    if (common_twos > 0) {
+        _numerator >>= common_twos;
+        _denominator >>= common_twos;
+    }
+
+    for (unsigned int prime : {3u, 5u, 7u, 11u, 13u}) {
+        while (_numerator.mod_word(prime) == 0 && _denominator.mod_word(prime) == 0) {
+            _numerator.divide_word(prime);
+            _denominator.divide_word(prime);
+        }
+    }
+
+    _reduced = _denominator.is_one();
+}
+
+void fraction::mark_reduced()
+{
+    _reduced = true;
+    _reduced_bits = _numerator.bit_length() + _denominator.bit_length();
+}
+
+void fraction::reduce_full()
+{
     big_int _gcd = gcd(_numerator, _denominator);
-    if (_gcd > 1_bi) {
+    if (!_gcd.is_one()) {
         _numerator /= _gcd;
         _denominator /= _gcd;
     }
+
+    mark_reduced();
 }
 
 
+size_t fraction::precision_bits(fraction const &epsilon)
+{
+    // 2^-bits <= epsilon for bits = len(den) - len(num) + 1
+    size_t numerator_bits = epsilon._numerator.bit_length();
+    size_t denominator_bits = epsilon._denominator.bit_length();
+    return denominator_bits >= numerator_bits ? denominator_bits - numerator_bits + 1 : 0;
+}
+
 fraction::fraction(const pp_allocator<big_int::value_type> allocator)
         : _numerator(0, allocator), _denominator(1, allocator) {
 }
 
-fraction &fraction::operator+=(fraction const &other) & {
-    _numerator = _numerator * other._denominator + _denominator * other._numerator;
-    _denominator = _denominator * other._denominator;
-    optimise();
+fraction &fraction::set_normalization_mode(normalization_mode mode) & {
+    _mode = mode;
+    if (_mode == normalization_mode::eager && !_reduced) {
+        reduce_full();
+    }
+    return *this;
+}
+
+fraction fraction::from_fixed_point(big_int value, size_t bits) {
+    size_t common_twos = value.is_zero() ? bits : std::min(value.trailing_zero_bits(), bits);
+    value >>= common_twos;
+
+    fraction result;
+    result._numerator = std::move(value);
+    result._denominator = 1_bi << (bits - common_twos);
+    result.mark_reduced();
+    return result;
+}
+
+fraction fraction::from_coprime(big_int numerator, big_int denominator) {
+    if (denominator.is_zero()) {
+        throw std::invalid_argument("Denominator cannot be zero");
+    }
+
+    if (denominator.is_negative()) {
+        numerator = -numerator;
+        denominator = -denominator;
+    }
+
+    fraction result;
+    result._numerator = std::move(numerator);
+    result._denominator = std::move(denominator);
+    result.mark_reduced();
+    return result;
+}
+
+fraction::normalization_mode fraction::get_normalization_mode() const noexcept {
+    return _mode;
+}
+
+big_int const &fraction::numerator() const noexcept {
+    return _numerator;
+}
+
+big_int const &fraction::denominator() const noexcept {
+    return _denominator;
+}
+
+fraction &fraction::normalize() & {
+    if (!_reduced) {
+        reduce_full();
+    }
     return *this;
 }
 
+fraction &fraction::operator+=(fraction const &other) & {
+    return plus_assign(other, false);
+}
+
 fraction fraction::operator+(fraction const &other) const {
     fraction result = *this;
     result += other;
@@ -38,9 +235,54 @@ fraction fraction::operator+(fraction const &other) const {
 }
 
 fraction &fraction::operator-=(fraction const &other) & {
-    _numerator = _numerator * other._denominator - _denominator * other._numerator;
-    _denominator = _denominator * other._denominator;
-    optimise();
+    return plus_assign(other, true);
+}
+
+fraction &fraction::plus_assign(fraction const &other, bool subtract) & {
+    if (this == &other) {
+        fraction copy(other);
+        return plus_assign(copy, subtract);
+    }
+
+    if (_mode == normalization_mode::deferred || !_reduced || !other._reduced) {
+        big_int cross = _denominator * other._numerator;
+        _numerator *= other._denominator;
+        subtract ? _numerator -= cross : _numerator += cross;
+        _denominator *= other._denominator;
+        optimise();
+        return *this;
+    }
+
+    // Henrici: gcd is taken of denominators and of d1 instead of the whole result
+    big_int d1 = gcd(_denominator, other._denominator);
+
+    if (d1.is_one()) {
+        big_int cross = _denominator * other._numerator;
+        _numerator *= other._denominator;
+        subtract ? _numerator -= cross : _numerator += cross;
+        _denominator *= other._denominator;
+        mark_reduced();
+        return *this;
+    }
+
+    _denominator /= d1;
+    big_int cross = _denominator * other._numerator;
+    _numerator *= other._denominator / d1;
+    subtract ? _numerator -= cross : _numerator += cross;
+
+    if (_numerator.is_zero()) {
+        _denominator = 1_bi;
+        mark_reduced();
+        return *this;
+    }
+
+    big_int d2 = gcd(_numerator, d1);
+    if (!d2.is_one()) {
+        _numerator /= d2;
+    }
+    _denominator *= other._denominator / d2;
+
+    mark_reduced();
     return *this;
 }
 
@@ -58,9 +300,37 @@ fraction fraction::operator-() const {
 }
 
 fraction &fraction::operator*=(fraction const &other) & {
-    _numerator *= other._numerator;
-    _denominator *= other._denominator;
-    optimise();
+    if (this == &other) {
+        fraction copy(other);
+        return *this *= copy;
+    }
+
+    if (_mode == normalization_mode::deferred || !_reduced || !other._reduced) {
+        _numerator *= other._numerator;
+        _denominator *= other._denominator;
+        optimise();
+        return *this;
+    }
+
+    // cross reduction: (a / b) * (c / d) = ((a / g1) * (c / g2)) / ((b / g2) * (d / g1))
+    big_int g1 = gcd(_numerator, other._denominator);
+    big_int g2 = gcd(other._numerator, _denominator);
+
+    if (g1.is_one()) {
+        _denominator *= other._denominator;
+    } else {
+        _numerator /= g1;
+        _denominator *= other._denominator / g1;
+    }
+
+    if (g2.is_one()) {
+        _numerator *= other._numerator;
+    } else {
+        _denominator /= g2;
+        _numerator *= other._numerator / g2;
+    }
+
+    mark_reduced();
     return *this;
 }
 
@@ -71,12 +341,45 @@ fraction fraction::operator*(fraction const &other) const {
 }
 
 fraction &fraction::operator/=(fraction const &other) & {
-    if (other._numerator == 0) {
+    if (other._numerator.is_zero()) {
         throw std::invalid_argument("Division by zero");
     }
-    _numerator *= other._denominator;
-    _denominator *= other._numerator;
-    optimise();
+    if (this == &other) {
+        fraction copy(other);
+        return *this /= copy;
+    }
+
+    if (_mode == normalization_mode::deferred || !_reduced || !other._reduced) {
+        _numerator *= other._denominator;
+        _denominator *= other._numerator;
+        optimise();
+        return *this;
+    }
+
+    // cross reduction: (a / b) / (c / d) = ((a / g1) * (d / g2)) / ((b / g2) * (c / g1))
+    big_int g1 = gcd(_numerator, other._numerator);
+    big_int g2 = gcd(_denominator, other._denominator);
+
+    if (g1.is_one()) {
+        _denominator *= other._numerator;
+    } else {
+        _numerator /= g1;
+        _denominator *= other._numerator / g1;
+    }
+
+    if (g2.is_one()) {
+        _numerator *= other._denominator;
+    } else {
+        _denominator /= g2;
+        _numerator *= other._denominator / g2;
+    }
+
+    if (_denominator.is_negative()) {
+        _numerator = -_numerator;
+        _denominator = -_denominator;
+    }
+
+    mark_reduced();
     return *this;
 }
 
@@ -87,10 +390,51 @@ fraction fraction::operator/(fraction const &other) const {
 }
 
 bool fraction::operator==(fraction const &other) const noexcept {
+    if (!_reduced || !other._reduced) {
+        return (*this <=> other) == std::partial_ordering::equivalent;
+    }
     return _numerator == other._numerator && _denominator == other._denominator;
 }
 
 std::partial_ordering fraction::operator<=>(const fraction& other) const noexcept {
+    // denominators are positive, so sign of numerator is sign of value
+    int sign = _numerator.is_zero() ? 0 : (_numerator.is_negative() ? -1 : 1);
+    int other_sign = other._numerator.is_zero() ? 0 : (other._numerator.is_negative() ? -1 : 1);
+    if (sign != other_sign) {
+        return sign < other_sign ? std::partial_ordering::less : std::partial_ordering::greater;
+    }
+    if (sign == 0) {
+        return std::partial_ordering::equivalent;
+    }
+
+    // orders of magnitude compare |this| and |other|, result is flipped for negative values
+    auto by_magnitude = [sign](bool greater) {
+        return greater == (sign > 0) ? std::partial_ordering::greater : std::partial_ordering::less;
+    };
+
+    // |x| lies in (2^(len(num) - len(den) - 1), 2^(len(num) - len(den) + 1))
+    auto exponent = static_cast<long long>(_numerator.bit_length()) - static_cast<long long>(_denominator.bit_length());
+    auto other_exponent = static_cast<long long>(other._numerator.bit_length()) - static_cast<long long>(other._denominator.bit_length());
+    if (exponent >= other_exponent + 2 || other_exponent >= exponent + 2) {
+        return by_magnitude(exponent > other_exponent);
+    }
+
+    // leading limbs give about 53 correct bits of each value, so relative gap above 2^-40 is decided by doubles
+    constexpr double APPROXIMATION_TOLERANCE = 0x1p-40;
+    auto [numerator_mantissa, numerator_exponent] = _numerator.frexp();
+    auto [denominator_mantissa, denominator_exponent] = _denominator.frexp();
+    auto [other_numerator_mantissa, other_numerator_exponent] = other._numerator.frexp();
+    auto [other_denominator_mantissa, other_denominator_exponent] = other._denominator.frexp();
+
+    int scale = static_cast<int>(static_cast<long long>(numerator_exponent) - static_cast<long long>(denominator_exponent)
+            - static_cast<long long>(other_numerator_exponent) + static_cast<long long>(other_denominator_exponent));
+    double approximation = std::ldexp(numerator_mantissa / denominator_mantissa, scale);
+    double other_approximation = other_numerator_mantissa / other_denominator_mantissa;
+
+    if (std::fabs(approximation - other_approximation) > APPROXIMATION_TOLERANCE * std::max(approximation, other_approximation)) {
+        return by_magnitude(approximation > other_approximation);
+    }
+
     big_int lhs = _numerator * other._denominator;
     big_int rhs = _denominator * other._numerator;
     if (lhs < rhs) return std::partial_ordering::less;
@@ -122,120 +466,272 @@ std::istream &operator>>(std::istream &stream, fraction &obj) {
 }
 
 std::string fraction::to_string() const {
+    if (!_reduced) {
+        fraction reduced(*this);
+        return reduced.normalize().to_string();
+    }
     std::stringstream ss;
     ss << _numerator << "/" << _denominator;
     return ss.str();
 }
 
-fraction fraction::sin(fraction const &epsilon) const
+double fraction::to_double() const
 {
-    fraction x = *this;
-    fraction x_squared = x * x;
-    fraction result = x;
-    fraction term = x;
-    big_int divisor = 1;
-    fraction numerator = x;
+    if (_numerator.is_zero()) {
+        return 0.0;
+    }
+
+    constexpr int MANTISSA_BITS = std::numeric_limits<double>::digits;
+    constexpr int MIN_EXPONENT = std::numeric_limits<double>::min_exponent - 1;
+    constexpr long long QUOTIENT_BITS = 62;
+
+    big_int magnitude = _numerator.is_negative() ? -_numerator : _numerator;
+
+    // q = floor(|x| * 2^shift) has 62 or 63 bits, sticky tells whether anything was cut off
+    long long shift = QUOTIENT_BITS - (static_cast<long long>(magnitude.bit_length()) - static_cast<long long>(_denominator.bit_length()));
+    big_int numerator = shift >= 0 ? magnitude << static_cast<size_t>(shift) : magnitude;
+    big_int denominator = shift >= 0 ? _denominator : _denominator << static_cast<size_t>(-shift);
 
-    for (int n = 1; ; ++n) {
-        divisor *= (2*n) * (2*n + 1);
-        numerator *= x_squared;
-        term = numerator / fraction(divisor, 1);
+    big_int quotient = numerator / denominator;
+    bool sticky = !(numerator - quotient * denominator).is_zero();
+    uint64_t q = quotient.mod_word(1ull << 63);
 
-        if (term.abs() <= epsilon) break;
+    // |x| lies in [2^(exponent - 1), 2^exponent), subnormals keep fewer mantissa bits
+    int width = std::bit_width(q);
+    long long exponent = width - shift;
+    long long kept = std::min<long long>(MANTISSA_BITS, exponent - MIN_EXPONENT + MANTISSA_BITS - 1);
 
-        result += (n % 2 == 1) ? -term : term;
+    double result;
+    if (kept < 0) {
+        result = 0.0;
+    } else {
+        int dropped = width - static_cast<int>(kept);
+        uint64_t mantissa = q;
+
+        if (dropped > 0) {
+            mantissa = dropped < 64 ? q >> dropped : 0;
+            uint64_t rest = q & ((1ull << dropped) - 1);
+            uint64_t half = 1ull << (dropped - 1);
+
+            if (rest > half || (rest == half && (sticky || (mantissa & 1)))) {
+                ++mantissa;
+            }
+        }
+
+        result = std::ldexp(static_cast<double>(mantissa), static_cast<int>(dropped - shift));
     }
 
-    return result;
+    return _numerator.is_negative() ? -result : result;
 }
 
-fraction fraction::cos(fraction const &epsilon) const
+std::ostream &fraction::to_decimal(std::ostream &stream, size_t digits) const
 {
-    fraction x = *this;
-    fraction x_squared = x * x;
-    fraction result(1, 1);
-    fraction term(1, 1);
-    big_int divisor = 1;
-    fraction num(1, 1);
+    constexpr size_t CHUNK_DIGITS = 9;
+    const big_int chunk_scale(1000000000);
 
-    for (int n = 1; ; ++n) {
-        divisor *= (2*n - 1) * (2*n);
-        num *= x_squared;
-        term = num / fraction(divisor, 1);
+    big_int remainder = _numerator.is_negative() ? -_numerator : _numerator;
+    big_int integer_part = remainder / _denominator;
+    remainder -= integer_part * _denominator;
 
-        if (term.abs() <= epsilon) break;
+    if (_numerator.is_negative()) {
+        stream << '-';
+    }
+    stream << integer_part;
 
-        result += (n % 2 == 1) ? -term : term;
+    if (digits == 0) {
+        return stream;
+    }
+    stream << '.';
+
+    char chunk[CHUNK_DIGITS + 1];
+    while (digits > 0) {
+        remainder *= chunk_scale;
+        big_int next = remainder / _denominator;
+        remainder -= next * _denominator;
+
+        std::snprintf(chunk, sizeof(chunk), "%09llu", next.mod_word(1000000000ull));
+        size_t taken = std::min(digits, CHUNK_DIGITS);
+        stream.write(chunk, static_cast<std::streamsize>(taken));
+        digits -= taken;
     }
 
-    return result;
+    return stream;
+}
+
+size_t fraction::reduce_argument(size_t bits, fraction &reduced) const
+{
+    fraction magnitude = this->abs();
+    if (magnitude < fraction(3, 4)) {
+        reduced = *this;
+        return 0;
+    }
+
+    // k = round(|x| / (pi / 2)) is estimated with a short pi, error of k by one keeps |r| close to pi / 4
+    fraction quotient = magnitude / (pi_to_bits(REDUCTION_ESTIMATE_BITS + magnitude._numerator.bit_length()) / fraction(2, 1));
+    big_int k = (quotient._numerator * 2_bi + quotient._denominator) / (quotient._denominator * 2_bi);
+
+    fraction half_pi = pi_to_bits(bits + k.bit_length() + 2) / fraction(2, 1);
+    reduced = magnitude - fraction(k, 1_bi) * half_pi;
+
+    size_t quadrant = static_cast<size_t>(k.mod_word(4));
+    if (_numerator.is_negative()) {
+        reduced = -reduced;
+        quadrant = (4 - quadrant) % 4;
+    }
+
+    return quadrant;
+}
+
+fraction fraction::sin(fraction const &epsilon, evaluation_mode mode) const
+{
+    if (_numerator.is_zero()) {
+        return fraction(0_bi, 1_bi);
+    }
+
+    size_t bits = precision_bits(epsilon) + 1;
+    fraction reduced;
+    size_t quadrant = reduce_argument(bits, reduced);
+    if (reduced != *this) {
+        // reduced argument already carries rounding of pi, exact summation would only drag it through huge operands
+        mode = evaluation_mode::fixed_point;
+    }
+
+    fraction result = quadrant % 2 == 0 ? reduced.sin_series(bits, mode) : reduced.cos_series(bits, mode);
+    return quadrant >= 2 ? -result : result;
+}
+
+fraction fraction::cos(fraction const &epsilon, evaluation_mode mode) const
+{
+    size_t bits = precision_bits(epsilon) + 1;
+    fraction reduced;
+    size_t quadrant = reduce_argument(bits, reduced);
+    if (reduced != *this) {
+        mode = evaluation_mode::fixed_point;
+    }
+
+    fraction result = quadrant % 2 == 0 ? reduced.cos_series(bits, mode) : reduced.sin_series(bits, mode);
+    return quadrant == 1 || quadrant == 2 ? -result : result;
+}
+
+fraction fraction::sin_series(size_t bits, evaluation_mode mode) const
+{
+    if (_numerator.is_zero()) {
+        return fraction(0_bi, 1_bi);
+    }
+
+    big_int u = _numerator;
+    big_int v = _denominator;
+    big_int minus_u_squared = -(u * u);
+    big_int v_squared = v * v;
+
+    // x^(2n + 1) / (2n + 1)!: p(n) = -u^2, q(n) = v^2 * 2n * (2n + 1)
+    hypergeometric_series series(
+            [u, minus_u_squared](size_t n) { return n == 0 ? u : minus_u_squared; },
+            [v, v_squared](size_t n) { return n == 0 ? v : v_squared * big_int(2 * n * (2 * n + 1)); });
+
+    return mode == evaluation_mode::fixed_point
+            ? series.sum_fixed_point(bits)
+            : series.sum_to_precision(bits);
+}
+
+fraction fraction::cos_series(size_t bits, evaluation_mode mode) const
+{
+    big_int minus_u_squared = -(_numerator * _numerator);
+    big_int v_squared = _denominator * _denominator;
+
+    // x^(2n) / (2n)!: p(n) = -u^2, q(n) = v^2 * (2n - 1) * 2n
+    hypergeometric_series series(
+            [minus_u_squared](size_t n) { return n == 0 ? 1_bi : minus_u_squared; },
+            [v_squared](size_t n) { return n == 0 ? 1_bi : v_squared * big_int((2 * n - 1) * 2 * n); });
 
+    return mode == evaluation_mode::fixed_point
+            ? series.sum_fixed_point(bits)
+            : series.sum_to_precision(bits);
 }
 
-fraction fraction::tg(fraction const &epsilon) const {
-    fraction cosine = this->cos(epsilon);
+fraction fraction::tg(fraction const &epsilon, evaluation_mode mode) const {
+    fraction cosine = this->cos(epsilon, mode);
     if (cosine._numerator == 0) {
         throw std::domain_error("Tangent undefined");
     }
-    return this->sin(epsilon) / cosine;
+    return this->sin(epsilon, mode) / cosine;
 }
 
-fraction fraction::ctg(fraction const &epsilon) const {
-    fraction sine = this->sin(epsilon);
+fraction fraction::ctg(fraction const &epsilon, evaluation_mode mode) const {
+    fraction sine = this->sin(epsilon, mode);
     if (sine._numerator == 0) {
         throw std::domain_error("Cotangent undefined");
     }
-    return this->cos(epsilon) / sine;
+    return this->cos(epsilon, mode) / sine;
 }
 
-fraction fraction::sec(fraction const &epsilon) const {
-    fraction cosine = this->cos(epsilon);
+fraction fraction::sec(fraction const &epsilon, evaluation_mode mode) const {
+    fraction cosine = this->cos(epsilon, mode);
     if (cosine._numerator == 0) {
         throw std::domain_error("Secant undefined");
     }
     return fraction(1, 1) / cosine;
 }
 
-fraction fraction::cosec(fraction const &epsilon) const {
-    fraction sine = this->sin(epsilon);
+fraction fraction::cosec(fraction const &epsilon, evaluation_mode mode) const {
+    fraction sine = this->sin(epsilon, mode);
     if (sine._numerator == 0) {
         throw std::domain_error("Cosecant undefined");
     }
     return fraction(1, 1) / sine;
 }
 
-fraction fraction::arctg(fraction const &epsilon) const {
+fraction fraction::arctg(fraction const &epsilon, evaluation_mode mode) const {
     if (this->abs() > fraction(1, 1)) {
 
         if (*this > fraction(0, 1)) {
-            return fraction(2,1) * calculate_half_pi(epsilon/fraction(2,1)) / fraction(2, 1) - (fraction(1, 1) / *this).arctg(epsilon);
+            return fraction(2,1) * calculate_half_pi(epsilon/fraction(2,1)) / fraction(2, 1) - (fraction(1, 1) / *this).arctg(epsilon, mode);
         } else {
-            return -fraction(2,1) * calculate_half_pi(epsilon/fraction(2,1)) / fraction(2, 1) - (fraction(1, 1) / *this).arctg(epsilon);
+            return -fraction(2,1) * calculate_half_pi(epsilon/fraction(2,1)) / fraction(2, 1) - (fraction(1, 1) / *this).arctg(epsilon, mode);
         }
     }
 
-    fraction x = *this;
-    fraction x_power = x;
-    fraction result = x;
-    int sign = -1;
-
-    for (int n = 1; ; ++n) {
-        x_power *= x * x;
-        fraction term = x_power / fraction(2 * n + 1, 1);
-        if (sign > 0) {
-            result += term;
-        } else {
-            result -= term;
-        }
+    if (_numerator.is_zero()) {
+        return fraction(0_bi, 1_bi);
+    }
 
-        if (term.abs() <= epsilon) {
-            break;
+    size_t bits = precision_bits(epsilon);
+    fraction argument = *this;
+    fraction offset(0_bi, 1_bi);
+
+    // near |x| = 1 terms only fall off like 1 / (2n + 1),
+    // arctg(x) = pi / 4 + arctg((x - 1) / (x + 1)) brings the argument down to |x| <= 1 / 3
+    if (this->abs() > fraction(1, 2)) {
+        fraction magnitude = this->abs();
+        bits += 1;
+        offset = pi_to_bits(bits) / fraction(4, 1);
+        argument = (magnitude - fraction(1, 1)) / (magnitude + fraction(1, 1));
+
+        if (_numerator.is_negative()) {
+            offset = -offset;
+            argument = -argument;
         }
 
-        sign *= -1;
+        if (argument._numerator.is_zero()) {
+            return offset;
+        }
     }
 
-    return result;
+    big_int u = argument._numerator;
+    big_int v = argument._denominator;
+    big_int minus_u_squared = -(u * u);
+    big_int v_squared = v * v;
+
+    // x^(2n + 1) / (2n + 1): p(n) = -u^2, q(n) = v^2, b(n) = 2n + 1
+    hypergeometric_series series(
+            [u, minus_u_squared](size_t n) { return n == 0 ? u : minus_u_squared; },
+            [v, v_squared](size_t n) { return n == 0 ? v : v_squared; },
+            nullptr,
+            [](size_t n) { return big_int(2 * n + 1); });
+
+    return offset + (mode == evaluation_mode::fixed_point
+            ? series.sum_fixed_point(bits)
+            : series.sum_to_precision(bits));
 }
 
 fraction fraction::pow(size_t degree) const {
@@ -254,7 +750,7 @@ fraction fraction::pow(size_t degree) const {
     return result;
 }
 
-fraction fraction::root(size_t degree, fraction const &epsilon) const {
+fraction fraction::root(size_t degree, fraction const &epsilon, evaluation_mode mode) const {
     if (degree == 0) {
         throw std::invalid_argument("Degree cannot be zero");
     }
@@ -266,6 +762,14 @@ fraction fraction::root(size_t degree, fraction const &epsilon) const {
     }
     fraction x = *this;
     if (x._numerator < 0) x = -x;
+
+    if (mode == evaluation_mode::fixed_point) {
+        size_t bits = precision_bits(epsilon) + FIXED_POINT_GUARD_BITS;
+        big_int scaled = (x._numerator << (degree * bits)) / x._denominator;
+        fraction result = from_fixed_point(integer_root(scaled, degree), bits);
+        return _numerator.is_negative() ? -result : result;
+    }
+
     fraction guess = *this / fraction(degree, 1);
     fraction prev_guess;
     do {
@@ -282,81 +786,82 @@ fraction fraction::root(size_t degree, fraction const &epsilon) const {
     return guess;
 }
 
-fraction fraction::log2(fraction const &epsilon) const
+fraction fraction::log2(fraction const &epsilon, evaluation_mode mode) const
 {
     if (_numerator <= 0 || _denominator <= 0) {
         throw std::domain_error("Logarithm of non-positive number is undefined");
     }
-    fraction ln2 = fraction(2, 1).ln(epsilon);
-    return this->ln(epsilon) / ln2;
+    return this->ln(epsilon, mode) / ln2(epsilon);
 }
 
-fraction fraction::ln_normalized(fraction const &x, fraction const &epsilon)
+fraction fraction::ln_normalized(fraction const &x, fraction const &epsilon, evaluation_mode mode)
 {
-
     if (x == fraction(1, 1)) {
         return fraction(0, 1);
     }
 
-
-
     fraction one(1, 1);
     fraction y = (x - one) / (x + one);
-    fraction y_power = y;
-    fraction result = y;
-    fraction term = y;
+    big_int u = y._numerator;
+    big_int v = y._denominator;
+    big_int u_squared = u * u;
+    big_int v_squared = v * v;
 
-    for (int n = 3; ; n += 2) {
-        y_power *= y * y;
-        term = y_power / fraction(n, 1);
-        result += term;
+    // 2 * y^(2n + 1) / (2n + 1): p(n) = u^2, q(n) = v^2, b(n) = 2n + 1
+    hypergeometric_series series(
+            [u, u_squared](size_t n) { return n == 0 ? u : u_squared; },
+            [v, v_squared](size_t n) { return n == 0 ? v : v_squared; },
+            nullptr,
+            [](size_t n) { return big_int(2 * n + 1); });
 
-        if (term.abs() <= epsilon) {
-            break;
-        }
-    }
+    fraction sum = mode == evaluation_mode::fixed_point
+            ? series.sum_fixed_point(precision_bits(epsilon) + 1)
+            : series.sum_to_precision(precision_bits(epsilon) + 1);
 
-    return result * fraction(2, 1);
+    return sum * fraction(2, 1);
 }
 
-fraction fraction::ln(fraction const& epsilon) const {
+fraction fraction::ln(fraction const &epsilon, evaluation_mode mode) const {
     if (_numerator <= 0 || _denominator <= 0) {
         throw std::domain_error("Natural logarithm of non-positive number is undefined");
     }
 
-    fraction x = *this;
-    fraction result(0, 1);
-    fraction two(2, 1);
-    fraction one(1, 1);
-
-    int k = 0;
+    // x = 2^k * m with m in [17/24, 17/12], close to [1/sqrt(2), sqrt(2)], so the series in (m - 1) / (m + 1)
+    // gains more than five bits per term
+    long long k = static_cast<long long>(_numerator.bit_length()) - static_cast<long long>(_denominator.bit_length());
+    fraction m = k >= 0
+            ? fraction(_numerator, _denominator << static_cast<size_t>(k))
+            : fraction(_numerator << static_cast<size_t>(-k), _denominator);
 
-
-    while (x >= two) {
-        x /= two;
+    if (m > fraction(17, 12)) {
+        m /= fraction(2, 1);
         ++k;
-    }
-
-    while (x < fraction(1, 2)) {
-        x *= two;
+    } else if (m < fraction(17, 24)) {
+        m *= fraction(2, 1);
         --k;
     }
 
+    fraction half_epsilon = epsilon / fraction(2, 1);
+    fraction result = ln_normalized(m, half_epsilon, mode);
 
-    return ln_normalized(x, epsilon) + fraction(k, 1) * ln_normalized(two, epsilon);
+    if (k != 0) {
+        size_t k_bits = std::bit_width(static_cast<unsigned long long>(k < 0 ? -k : k));
+        result += fraction(k, 1) * ln2_to_bits(precision_bits(half_epsilon) + k_bits);
+    }
+
+    return result;
 }
 
-fraction fraction::lg(fraction const &epsilon) const
+fraction fraction::lg(fraction const &epsilon, evaluation_mode mode) const
 {
     if (_numerator <= 0 || _denominator <= 0) {
         throw std::domain_error("Base-10 logarithm of non-positive number is undefined");
     }
-    fraction ln10 = fraction(10, 1).ln(epsilon);
-    return this->ln(epsilon) / ln10;
+    return this->ln(epsilon, mode) / ln10(epsilon);
 }
 
 
-fraction fraction::arcsin(fraction const &epsilon) const {
+fraction fraction::arcsin(fraction const &epsilon, evaluation_mode mode) const {
     if (*this < fraction(-1, 1) || *this > fraction(1, 1)) {
         throw std::domain_error("arcsin is only defined for values in [-1, 1]");
     }
@@ -365,43 +870,24 @@ fraction fraction::arcsin(fraction const &epsilon) const {
     if (*this == fraction(-1, 1)) return -calculate_half_pi(epsilon);
     if (*this == fraction(0, 1)) return fraction(0, 1);
 
-    fraction x = *this;
-    fraction x_power = x;
-    fraction result = x;
-    fraction term = x;
-
-    big_int n = 1;
-    big_int factorial_2n = 1;
-    big_int factorial_n = 1;
-    big_int four_pow_n = 1;
-
-    for (int i = 1; ; ++i) {
-
-        factorial_2n *= big_int(2 * i - 1);
-        factorial_2n *= big_int(2 * i);
-        factorial_n *= big_int(i);
-        four_pow_n *= big_int(4);
-
-        x_power *= x * x;
+    big_int u = _numerator;
+    big_int v = _denominator;
+    big_int u_squared = u * u;
+    big_int v_squared = v * v;
 
+    // (2n)! / (4^n * (n!)^2) * x^(2n + 1) / (2n + 1): p(n) = (2n - 1) * u^2, q(n) = 2n * v^2, b(n) = 2n + 1
+    hypergeometric_series series(
+            [u, u_squared](size_t n) { return n == 0 ? u : u_squared * big_int(2 * n - 1); },
+            [v, v_squared](size_t n) { return n == 0 ? v : v_squared * big_int(2 * n); },
+            nullptr,
+            [](size_t n) { return big_int(2 * n + 1); });
 
-        big_int numerator = factorial_2n * x_power._numerator;
-
-        big_int denominator = four_pow_n * factorial_n * factorial_n * big_int(2 * i + 1) * x_power._denominator;
-
-        term = fraction(numerator, denominator);
-
-        result += term;
-
-        if (term.abs() <= epsilon) {
-            break;
-        }
-    }
-
-    return result;
+    return mode == evaluation_mode::fixed_point
+            ? series.sum_fixed_point(precision_bits(epsilon))
+            : series.sum_to_precision(precision_bits(epsilon));
 }
 
-fraction fraction::arccos(fraction const &epsilon) const {
+fraction fraction::arccos(fraction const &epsilon, evaluation_mode mode) const {
 
     fraction abs_val = this->abs();
     if (abs_val > fraction(1, 1)) {
@@ -414,7 +900,7 @@ fraction fraction::arccos(fraction const &epsilon) const {
     if (*this == fraction(0, 1)) return calculate_half_pi(epsilon);
 
 
-    fraction arcsin_val = this->arcsin(epsilon);
+    fraction arcsin_val = this->arcsin(epsilon, mode);
 
     return calculate_half_pi(epsilon) - arcsin_val;
 
@@ -422,14 +908,14 @@ fraction fraction::arccos(fraction const &epsilon) const {
 
 //ЕБЛАН
 
-fraction fraction::arcctg(fraction const &epsilon) const {
+fraction fraction::arcctg(fraction const &epsilon, evaluation_mode mode) const {
 
-    fraction arctg_val = this->arctg(epsilon);
+    fraction arctg_val = this->arctg(epsilon, mode);
 
     return calculate_half_pi(epsilon) - arctg_val;
 }
 
-fraction fraction::arcsec(fraction const &epsilon) const {
+fraction fraction::arcsec(fraction const &epsilon, evaluation_mode mode) const {
 
     fraction abs_val = this->abs();
     if (abs_val < fraction(1, 1)) {
@@ -438,10 +924,10 @@ fraction fraction::arcsec(fraction const &epsilon) const {
 
 
     fraction reciprocal = fraction(1, 1) / *this;
-    return reciprocal.arccos(epsilon);
+    return reciprocal.arccos(epsilon, mode);
 }
 
-fraction fraction::arccosec(fraction const &epsilon) const {
+fraction fraction::arccosec(fraction const &epsilon, evaluation_mode mode) const {
 
     fraction abs_val = this->abs();
     if (abs_val < fraction(1, 1)) {
@@ -450,30 +936,72 @@ fraction fraction::arccosec(fraction const &epsilon) const {
 
 
     fraction reciprocal = fraction(1, 1) / *this;
-    return reciprocal.arcsin(epsilon);
+    return reciprocal.arcsin(epsilon, mode);
 }
 
 fraction fraction::abs() const {
-    big_int abs_numerator = _numerator >= 0_bi ? _numerator : -_numerator;
-    big_int abs_denominator = _denominator >= 0_bi ? _denominator : -_denominator;
+    big_int abs_numerator = _numerator.is_negative() ? -_numerator : _numerator;
+    big_int abs_denominator = _denominator.is_negative() ? -_denominator : _denominator;
     fraction abs_frac(abs_numerator, abs_denominator);
     return abs_frac;
 }
 
 fraction fraction::calculate_half_pi(const fraction &epsilon) {
+    return pi_to_bits(precision_bits(epsilon) + 2) / fraction(2, 1);
+}
 
-    long double pi_2 = M_PI_2;
-    big_int tmp = epsilon._denominator;
+fraction fraction::pi_to_bits(size_t bits)
+{
+    static constant_cache cache;
 
-    fraction PI_2(1,epsilon._denominator * 10_bi);
-    while (tmp) {
-        pi_2 *= 10;
-        while (pi_2 > 10.0) {
-            pi_2 -= 10;
-        }
-        PI_2._numerator *= 10_bi;
-        PI_2._numerator += big_int(static_cast<unsigned long long>(pi_2));
-        tmp /= 10_bi;
-    }
-    return PI_2;
+    return cached_constant(cache, bits, [](size_t extended) {
+        // pi = 16 * arctg(1 / 5) - 4 * arctg(1 / 239)
+        size_t guarded = extended + CONSTANT_GUARD_BITS;
+        fraction value = fraction(16, 1) * inverse_arctg(5, guarded, false)
+                - fraction(4, 1) * inverse_arctg(239, guarded, false);
+        return (value._numerator << extended) / value._denominator;
+    });
+}
+
+fraction fraction::ln2_to_bits(size_t bits)
+{
+    static constant_cache cache;
+
+    return cached_constant(cache, bits, [](size_t extended) {
+        // ln 2 = 18 * artanh(1 / 26) - 2 * artanh(1 / 4801) + 8 * artanh(1 / 8749)
+        size_t guarded = extended + CONSTANT_GUARD_BITS;
+        fraction value = fraction(18, 1) * inverse_arctg(26, guarded, true)
+                - fraction(2, 1) * inverse_arctg(4801, guarded, true)
+                + fraction(8, 1) * inverse_arctg(8749, guarded, true);
+        return (value._numerator << extended) / value._denominator;
+    });
+}
+
+fraction fraction::ln10_to_bits(size_t bits)
+{
+    static constant_cache cache;
+
+    return cached_constant(cache, bits, [](size_t extended) {
+        // ln 10 = 46 * artanh(1 / 31) + 34 * artanh(1 / 49) + 20 * artanh(1 / 161)
+        size_t guarded = extended + CONSTANT_GUARD_BITS;
+        fraction value = fraction(46, 1) * inverse_arctg(31, guarded, true)
+                + fraction(34, 1) * inverse_arctg(49, guarded, true)
+                + fraction(20, 1) * inverse_arctg(161, guarded, true);
+        return (value._numerator << extended) / value._denominator;
+    });
+}
+
+fraction fraction::pi(fraction const &epsilon)
+{
+    return pi_to_bits(precision_bits(epsilon) + 1);
+}
+
+fraction fraction::ln2(fraction const &epsilon)
+{
+    return ln2_to_bits(precision_bits(epsilon) + 1);
+}
+
+fraction fraction::ln10(fraction const &epsilon)
+{
+    return ln10_to_bits(precision_bits(epsilon) + 1);
 }
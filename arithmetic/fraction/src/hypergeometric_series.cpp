@@ -0,0 +1,146 @@
+#include "../include/hypergeometric_series.h"
+#include <cmath>
+#include <limits>
+#include <bit>
+#include <stdexcept>
+
+namespace
+{
+    /** Terms are counted until they drop GUARD_BITS below requested precision,
+     *  which covers tails bounded by a few first omitted terms
+     */
+    constexpr size_t GUARD_BITS = 4;
+
+    /** Binary splitting over more terms builds products too large to hold,
+     *  such series have to be brought to a faster converging argument first
+     */
+    constexpr size_t MAX_TERMS = size_t(1) << 22;
+
+    double log2_abs(big_int const &value)
+    {
+        auto [mantissa, exponent] = value.frexp();
+        return std::log2(mantissa) + static_cast<double>(exponent);
+    }
+}
+
+hypergeometric_series::hypergeometric_series(coefficient p, coefficient q, coefficient a, coefficient b)
+        : _p(std::move(p)), _q(std::move(q)), _a(std::move(a)), _b(std::move(b))
+{
+}
+
+big_int hypergeometric_series::a(size_t n) const
+{
+    return _a ? _a(n) : big_int(1);
+}
+
+big_int hypergeometric_series::b(size_t n) const
+{
+    return _b ? _b(n) : big_int(1);
+}
+
+size_t hypergeometric_series::terms_count(size_t precision_bits) const
+{
+    const double target = -static_cast<double>(precision_bits + GUARD_BITS);
+    double log2_product = 0.0;
+    double previous = std::numeric_limits<double>::infinity();
+
+    for (size_t n = 0; ; ++n)
+    {
+        if (n == MAX_TERMS)
+        {
+            throw std::domain_error("series converges too slowly for the requested precision");
+        }
+
+        big_int p = _p(n);
+        if (p.is_zero())
+        {
+            return n;
+        }
+
+        log2_product += log2_abs(p) - log2_abs(_q(n));
+
+        big_int numerator = a(n);
+        double current = numerator.is_zero()
+                ? -std::numeric_limits<double>::infinity()
+                : log2_product + log2_abs(numerator) - log2_abs(b(n));
+
+        if (current < target && current < previous)
+        {
+            return n;
+        }
+
+        previous = current;
+    }
+}
+
+hypergeometric_series::partial_sum hypergeometric_series::split(size_t from, size_t to) const
+{
+    if (to - from == 1)
+    {
+        partial_sum leaf{_p(from), _q(from), b(from), a(from)};
+        leaf.T *= leaf.P;
+        return leaf;
+    }
+
+    size_t middle = from + (to - from) / 2;
+    partial_sum left = split(from, middle);
+    partial_sum right = split(middle, to);
+
+    // T = Br * Qr * Tl + Bl * Pl * Tr
+    left.T *= right.B;
+    left.T *= right.Q;
+    right.T *= left.B;
+    right.T *= left.P;
+    left.T += right.T;
+
+    left.P *= right.P;
+    left.Q *= right.Q;
+    left.B *= right.B;
+
+    return left;
+}
+
+fraction hypergeometric_series::sum(size_t terms) const
+{
+    if (terms == 0)
+    {
+        return fraction(0_bi, 1_bi);
+    }
+
+    partial_sum result = split(0, terms);
+    result.B *= result.Q;
+
+    return fraction(std::move(result.T), std::move(result.B));
+}
+
+fraction hypergeometric_series::sum_to_precision(size_t precision_bits) const
+{
+    return sum(terms_count(precision_bits));
+}
+
+fraction hypergeometric_series::sum_fixed_point(size_t precision_bits) const
+{
+    const size_t terms = terms_count(precision_bits);
+    const size_t scale = precision_bits + GUARD_BITS + std::bit_width(terms);
+
+    big_int sum;
+    big_int term = 1_bi << scale;
+
+    for (size_t n = 0; n < terms; ++n)
+    {
+        term *= _p(n);
+        term /= _q(n);
+
+        if (term.is_zero())
+        {
+            break;
+        }
+
+        big_int addend = term * a(n);
+        addend /= b(n);
+        sum += addend;
+    }
+
+    sum >>= scale - precision_bits - 1;
+    return fraction::from_fixed_point(std::move(sum), precision_bits + 1);
+}
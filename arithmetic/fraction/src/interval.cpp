@@ -0,0 +1,250 @@
+#include "../include/interval.h"
+#include <algorithm>
+#include <stdexcept>
+
+namespace
+{
+    /** floor(value * 2^bits)
+     */
+    big_int floor_scaled(fraction const &value, size_t bits)
+    {
+        big_int scaled = value.numerator() << bits;
+        big_int quotient = scaled / value.denominator();
+
+        if (scaled.is_negative() && !(scaled - quotient * value.denominator()).is_zero()) {
+            --quotient;
+        }
+
+        return quotient;
+    }
+
+    /** Endpoint is kept as is while its denominator fits into precision
+     */
+    bool needs_rounding(fraction const &value, size_t bits)
+    {
+        return value.denominator().bit_length() > bits + 1;
+    }
+}
+
+interval::interval(fraction const &value, size_t precision)
+        : interval(value, value, precision)
+{
+}
+
+interval::interval(fraction const &lower, fraction const &upper, size_t precision)
+        : _lower(lower), _upper(upper), _precision(precision)
+{
+    if (_lower > _upper) {
+        throw std::invalid_argument("Lower bound of interval exceeds upper bound");
+    }
+
+    round_outward();
+}
+
+interval &interval::round_outward() &
+{
+    if (needs_rounding(_lower, _precision)) {
+        _lower = fraction::from_fixed_point(floor_scaled(_lower, _precision), _precision);
+    }
+
+    if (needs_rounding(_upper, _precision)) {
+        _upper = fraction::from_fixed_point(-floor_scaled(-_upper, _precision), _precision);
+    }
+
+    return *this;
+}
+
+fraction const &interval::lower() const noexcept
+{
+    return _lower;
+}
+
+fraction const &interval::upper() const noexcept
+{
+    return _upper;
+}
+
+size_t interval::precision() const noexcept
+{
+    return _precision;
+}
+
+fraction interval::width() const
+{
+    return _upper - _lower;
+}
+
+bool interval::contains(fraction const &value) const
+{
+    return _lower <= value && value <= _upper;
+}
+
+interval &interval::operator+=(interval const &other) &
+{
+    return *this = interval(_lower + other._lower, _upper + other._upper, std::max(_precision, other._precision));
+}
+
+interval interval::operator+(interval const &other) const
+{
+    interval result = *this;
+    result += other;
+    return result;
+}
+
+interval &interval::operator-=(interval const &other) &
+{
+    return *this = interval(_lower - other._upper, _upper - other._lower, std::max(_precision, other._precision));
+}
+
+interval interval::operator-(interval const &other) const
+{
+    interval result = *this;
+    result -= other;
+    return result;
+}
+
+interval &interval::operator*=(interval const &other) &
+{
+    fraction products[] = {_lower * other._lower, _lower * other._upper, _upper * other._lower, _upper * other._upper};
+    auto [lowest, highest] = std::minmax_element(std::begin(products), std::end(products));
+
+    return *this = interval(*lowest, *highest, std::max(_precision, other._precision));
+}
+
+interval interval::operator*(interval const &other) const
+{
+    interval result = *this;
+    result *= other;
+    return result;
+}
+
+interval &interval::operator/=(interval const &other) &
+{
+    if (other.contains(fraction(0_bi, 1_bi))) {
+        throw std::domain_error("Division by interval containing zero");
+    }
+
+    fraction one(1_bi, 1_bi);
+    return *this *= interval(one / other._upper, one / other._lower, other._precision);
+}
+
+interval interval::operator/(interval const &other) const
+{
+    interval result = *this;
+    result /= other;
+    return result;
+}
+
+interval interval::operator-() const
+{
+    return interval(-_upper, -_lower, _precision);
+}
+
+std::partial_ordering interval::operator<=>(interval const &other) const
+{
+    if (_upper < other._lower) {
+        return std::partial_ordering::less;
+    }
+    if (_lower > other._upper) {
+        return std::partial_ordering::greater;
+    }
+    if (_lower == _upper && other._lower == other._upper && _lower == other._lower) {
+        return std::partial_ordering::equivalent;
+    }
+    return std::partial_ordering::unordered;
+}
+
+std::partial_ordering interval::compare(evaluator const &lhs, evaluator const &rhs,
+                                        size_t initial_precision, size_t max_precision)
+{
+    for (size_t precision = std::max<size_t>(initial_precision, 1); ; precision *= 2) {
+        std::partial_ordering order = lhs(precision) <=> rhs(precision);
+
+        if (order != std::partial_ordering::unordered || precision >= max_precision) {
+            return order;
+        }
+    }
+}
+
+fraction interval::evaluation_error() const
+{
+    return fraction(1_bi, 1_bi << _precision);
+}
+
+interval interval::pi_enclosure(size_t precision)
+{
+    fraction error(1_bi, 1_bi << (precision + 1));
+    fraction pi = fraction::pi(error);
+
+    return interval(pi - error, pi + error, precision);
+}
+
+interval interval::sin() const
+{
+    interval half_pi = pi_enclosure(_precision) / interval(fraction(2_bi, 1_bi), _precision);
+    return (*this - half_pi).cos();
+}
+
+interval interval::cos() const
+{
+    fraction one(1_bi, 1_bi);
+
+    // integers within x / pi are candidates for extrema, two of them mean a full period
+    interval turns = *this / pi_enclosure(_precision);
+    big_int first = -floor_scaled(-turns._lower, 0);
+    big_int last = floor_scaled(turns._upper, 0);
+
+    if (first < last) {
+        return interval(-one, one, _precision);
+    }
+
+    fraction error = evaluation_error();
+    fraction at_lower = _lower.cos(error / fraction(2_bi, 1_bi), fraction::evaluation_mode::fixed_point);
+    fraction at_upper = _upper.cos(error / fraction(2_bi, 1_bi), fraction::evaluation_mode::fixed_point);
+
+    fraction lower = std::min(at_lower, at_upper) - error;
+    fraction upper = std::max(at_lower, at_upper) + error;
+
+    if (first == last) {
+        if (first.mod_word(2) == 0) {
+            upper = one;
+        } else {
+            lower = -one;
+        }
+    }
+
+    return interval(std::max(lower, -one), std::min(upper, one), _precision);
+}
+
+interval interval::ln() const
+{
+    if (_lower <= fraction(0_bi, 1_bi)) {
+        throw std::domain_error("Logarithm of interval with non-positive values");
+    }
+
+    fraction error = evaluation_error();
+    fraction half_error = error / fraction(2_bi, 1_bi);
+
+    return interval(_lower.ln(half_error, fraction::evaluation_mode::fixed_point) - error,
+                    _upper.ln(half_error, fraction::evaluation_mode::fixed_point) + error,
+                    _precision);
+}
+
+interval interval::root(size_t degree) const
+{
+    if (degree % 2 == 0 && _lower < fraction(0_bi, 1_bi)) {
+        throw std::domain_error("Even root of interval with negative values");
+    }
+
+    fraction error = evaluation_error();
+    fraction half_error = error / fraction(2_bi, 1_bi);
+
+    return interval(_lower.root(degree, half_error, fraction::evaluation_mode::fixed_point) - error,
+                    _upper.root(degree, half_error, fraction::evaluation_mode::fixed_point) + error,
+                    _precision);
+}
+
+std::ostream &operator<<(std::ostream &stream, interval const &obj)
+{
+    return stream << '[' << obj._lower << ", " << obj._upper << ']';
+}
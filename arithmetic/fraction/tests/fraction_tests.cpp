@@ -1,7 +1,11 @@
+#include <batch_eval.h>
 #include <client_logger.h>
 #include <client_logger_builder.h>
+#include <dyadic.h>
 #include <fraction.h>
 #include <gtest/gtest.h>
+#include <interval.h>
+#include <sstream>
 
 const fraction EPS(1_bi, 1000000_bi);
 
@@ -473,6 +477,20 @@ TEST(trigonometricTests, arctg)
     logger->debug(a.to_string() + "  " + " = " + c.to_string());
 }
 
+TEST(trigonometricTests, arctgNearOne)
+{
+    const fraction epsilon(1_bi, big_int("1" + std::string(600, '0')));
+
+    const auto quarter_pi = fraction(1, 1).arctg(epsilon);
+    const auto half_pi = fraction::calculate_half_pi(epsilon);
+    EXPECT_TRUE(abs(quarter_pi * fraction(2, 1) - half_pi) <= epsilon * fraction(4, 1));
+
+    const auto c = fraction(-9, 10).arctg(fraction(EPS), fraction::evaluation_mode::fixed_point);
+    // -0.73281510
+    const auto expected = fraction(-7328151_bi, 10000000_bi);
+    EXPECT_TRUE(abs(c - expected) <= fraction(EPS)) << "Получено: " << c;
+}
+
 TEST(trigonometricTests, ctg)
 {
     logger *logger = create_logger(std::vector<std::pair<std::string, logger::severity>>{
@@ -581,6 +599,43 @@ TEST(trigonometricTests, arccosec)
     logger->debug(a.to_string() + "  " + " = " + d.to_string());
 }
 
+TEST(trigonometricTests, sinCosHighPrecision)
+{
+    logger *logger = create_logger(std::vector<std::pair<std::string, logger::severity>>{
+        {"bigint_logs.txt", logger::severity::information},
+    });
+
+    const fraction epsilon{1_bi, big_int("1000000000000000000000000000000")};
+    const fraction a{big_int("1"), big_int("3")};
+    const auto s = a.sin(epsilon);
+    const auto c = a.cos(epsilon);
+    const auto diff = abs(s * s + c * c - fraction(1_bi, 1_bi));
+
+    EXPECT_TRUE(diff <= epsilon) << "Получено: " << diff << "\nДопустимая ошибка: " << epsilon;
+    logger->debug(a.to_string() + "  " + " = " + s.to_string());
+}
+
+TEST(trigonometricTests, largeArgument)
+{
+    logger *logger = create_logger(std::vector<std::pair<std::string, logger::severity>>{
+        {"bigint_logs.txt", logger::severity::information},
+    });
+
+    const fraction epsilon{1_bi, big_int("1000000000000000000000000000000")};
+    const fraction pi{big_int("3141592653589793238462643383279502884197"), big_int("1000000000000000000000000000000000000000")};
+    EXPECT_TRUE(abs(fraction::pi(epsilon) - pi) <= epsilon);
+
+    const fraction a{big_int("-1000"), big_int("7")};
+    const auto s = a.sin(epsilon);
+    const auto c = a.cos(epsilon);
+    const auto expected = fraction(big_int("-852194"), big_int("10000000"));
+    const auto diff = abs(s * s + c * c - fraction(1_bi, 1_bi));
+
+    EXPECT_TRUE(diff <= fraction(3_bi, 1_bi) * epsilon) << "Получено: " << diff << "\nДопустимая ошибка: " << epsilon;
+    EXPECT_TRUE(abs(c - expected) <= fraction(1_bi, 1000000_bi)) << "Ожидалось: " << expected << "\nПолучено: " << c;
+    logger->debug(a.to_string() + "  " + " = " + s.to_string());
+}
+
 TEST(powTest, pow)
 {
     logger *logger = create_logger(std::vector<std::pair<std::string, logger::severity>>{
@@ -610,6 +665,25 @@ TEST(rootTests, root)
     logger->debug(a.to_string() + "  " + " = " + c.to_string());
 }
 
+TEST(rootTests, fixedPoint)
+{
+    logger *logger = create_logger(std::vector<std::pair<std::string, logger::severity>>{
+        {"bigint_logs.txt", logger::severity::information},
+    });
+
+    const fraction a{big_int("7"), big_int("5")};
+    const fraction epsilon{1_bi, big_int("10000000000000000000000000000000000000000")};
+    const auto c = a.root(3, epsilon, fraction::evaluation_mode::fixed_point);
+    const auto diff = abs(c.pow(3) - a);
+
+    EXPECT_TRUE(diff <= fraction(3_bi, 1_bi) * epsilon) << "Получено: " << c << "\nРазница: " << diff
+                                                       << "\nДопустимая ошибка: " << epsilon;
+
+    const auto l = a.ln(epsilon, fraction::evaluation_mode::fixed_point);
+    EXPECT_TRUE(abs(l - a.ln(fraction(EPS))) <= fraction(EPS));
+    logger->debug(a.to_string() + "  " + " = " + c.to_string());
+}
+
 TEST(logariphmTests, log2)
 {
     logger *logger = create_logger(std::vector<std::pair<std::string, logger::severity>>{
@@ -661,6 +735,50 @@ TEST(logariphmTests, log10)
     logger->debug(a.to_string() + "  " + " = " + c.to_string());
 }
 
+TEST(normalizationTests, deferred)
+{
+    logger *logger = create_logger(std::vector<std::pair<std::string, logger::severity>>{
+        {"bigint_logs.txt", logger::severity::information},
+    });
+
+    fraction eager(0_bi, 1_bi);
+    fraction deferred(0_bi, 1_bi);
+    deferred.set_normalization_mode(fraction::normalization_mode::deferred);
+
+    for (int k = 1; k <= 30; ++k)
+    {
+        eager += fraction(big_int(1), big_int(k));
+        deferred += fraction(big_int(1), big_int(k));
+    }
+
+    EXPECT_TRUE(deferred == eager);
+    EXPECT_TRUE(deferred.to_string() == eager.to_string());
+    EXPECT_TRUE(deferred.set_normalization_mode(fraction::normalization_mode::eager).to_string() == eager.to_string());
+    logger->debug(deferred.to_string());
+}
+
+TEST(normalizationTests, leftOperandMode)
+{
+    fraction deferred(1_bi, 3_bi);
+    deferred.set_normalization_mode(fraction::normalization_mode::deferred);
+    deferred *= fraction(6_bi, 1_bi);
+
+    fraction eager(1_bi, 2_bi);
+    eager += deferred;
+    eager *= deferred;
+    eager /= deferred;
+    fraction sum = eager + deferred;
+
+    EXPECT_EQ(eager.get_normalization_mode(), fraction::normalization_mode::eager);
+    EXPECT_EQ(sum.get_normalization_mode(), fraction::normalization_mode::eager);
+    EXPECT_TRUE(eager.to_string() == fraction(5_bi, 2_bi).to_string());
+    EXPECT_TRUE(sum.to_string() == fraction(9_bi, 2_bi).to_string());
+
+    fraction product = deferred * eager;
+    EXPECT_EQ(product.get_normalization_mode(), fraction::normalization_mode::deferred);
+    EXPECT_TRUE(product == fraction(5_bi, 1_bi));
+}
+
 auto main(int argc, char **argv) -> int
 {
     testing::InitGoogleTest(&argc, argv);
@@ -684,4 +802,121 @@ auto main(int argc, char **argv) -> int
     }
 
     return 0;
-}
\ No newline at end of file
+}
+TEST(comparisonTests, tiered)
+{
+    logger *logger = create_logger(std::vector<std::pair<std::string, logger::severity>>{
+        {"bigint_logs.txt", logger::severity::information},
+    });
+
+    const fraction a{big_int("123456789012345678901234567890"), big_int("987654321098765432109876543211")};
+    const fraction close{big_int("123456789012345678901234567891"), big_int("987654321098765432109876543211")};
+    const fraction far{big_int("1"), big_int("987654321098765432109876543211")};
+
+    EXPECT_TRUE(a < close);
+    EXPECT_TRUE(-close < -a);
+    EXPECT_TRUE(far < a);
+    EXPECT_TRUE(-a < far);
+    EXPECT_TRUE(fraction(0_bi, 1_bi) < far);
+    EXPECT_TRUE(a == fraction(a));
+    EXPECT_TRUE((a <=> close) == std::partial_ordering::less);
+    logger->debug(a.to_string() + " < " + close.to_string());
+}
+
+TEST(conversionTests, decimalAndDouble)
+{
+    logger *logger = create_logger(std::vector<std::pair<std::string, logger::severity>>{
+        {"bigint_logs.txt", logger::severity::information},
+    });
+
+    const fraction a{big_int("-22"), big_int("7")};
+    std::ostringstream stream;
+    a.to_decimal(stream, 20);
+
+    EXPECT_EQ(stream.str(), "-3.14285714285714285714");
+    EXPECT_EQ(a.to_double(), -22.0 / 7.0);
+    EXPECT_EQ(fraction(1_bi, 3_bi).to_double(), 1.0 / 3.0);
+    EXPECT_EQ(fraction(0_bi, 1_bi).to_double(), 0.0);
+    logger->debug(stream.str());
+}
+
+TEST(intervalTests, enclosures)
+{
+    logger *logger = create_logger(std::vector<std::pair<std::string, logger::severity>>{
+        {"bigint_logs.txt", logger::severity::information},
+    });
+
+    const interval x(fraction(1_bi, 1_bi), fraction(2_bi, 1_bi), 100);
+    const auto s = x.sin();
+    const auto c = x.cos();
+
+    // sin is 1 at pi / 2 inside [1, 2], cos changes sign there
+    EXPECT_TRUE(s.upper() == fraction(1_bi, 1_bi));
+    EXPECT_TRUE(s.contains(fraction(841471_bi, 1000000_bi)));
+    EXPECT_TRUE(c.contains(fraction(0_bi, 1_bi)));
+    EXPECT_TRUE(c.lower() < fraction(-416146_bi, 1000000_bi) && fraction(540302_bi, 1000000_bi) < c.upper());
+
+    const interval point(fraction(1_bi, 3_bi), 100);
+    EXPECT_TRUE((point * point).contains(fraction(1_bi, 9_bi)));
+    EXPECT_TRUE(point.ln().width() < fraction(1_bi, 1000000000000000000_bi));
+    EXPECT_THROW(interval(fraction(-1_bi, 1_bi), fraction(1_bi, 1_bi)).ln(), std::domain_error);
+    EXPECT_THROW(point / (point - point), std::domain_error);
+
+    // sqrt(2) against its 31-digit truncation needs about 100 bits to be decided
+    auto order = interval::compare(
+            [](size_t precision) { return interval(fraction(2_bi, 1_bi), precision).root(2); },
+            [](size_t precision) { return interval(fraction(big_int("14142135623730950488016887242097"), big_int("10000000000000000000000000000000")), precision); },
+            8);
+    EXPECT_TRUE(order == std::partial_ordering::less);
+    logger->debug(s.lower().to_string());
+}
+
+TEST(batchTests, parallelMatchesSequential)
+{
+    logger *logger = create_logger(std::vector<std::pair<std::string, logger::severity>>{
+        {"bigint_logs.txt", logger::severity::information},
+    });
+
+    std::vector<fraction> values;
+    for (int k = 1; k <= 64; ++k) {
+        values.emplace_back(big_int(k * 7), big_int(k + 3));
+    }
+
+    const fraction epsilon{1_bi, big_int("1000000000000000000000")};
+    const auto sines = batch_eval(&fraction::sin, values, epsilon, 4, fraction::evaluation_mode::fixed_point);
+    const auto roots = batch_eval([](fraction const &value, fraction const &precision) {
+        return value.root(3, precision, fraction::evaluation_mode::fixed_point);
+    }, values, epsilon, 3);
+
+    ASSERT_EQ(sines.size(), values.size());
+    for (size_t i = 0; i < values.size(); ++i) {
+        EXPECT_TRUE(sines[i] == values[i].sin(epsilon, fraction::evaluation_mode::fixed_point));
+        EXPECT_TRUE(roots[i] == values[i].root(3, epsilon, fraction::evaluation_mode::fixed_point));
+    }
+
+    values.emplace_back(-1_bi, 2_bi);
+    EXPECT_THROW(batch_eval(&fraction::ln, values, epsilon, 4), std::domain_error);
+    logger->debug(sines.front().to_string());
+}
+
+TEST(dyadicTests, exactArithmetic)
+{
+    logger *logger = create_logger(std::vector<std::pair<std::string, logger::severity>>{
+        {"bigint_logs.txt", logger::severity::information},
+    });
+
+    const dyadic a(12_bi, -5);
+    const dyadic b(-5_bi, 2);
+
+    EXPECT_EQ(a.mantissa(), 3_bi);
+    EXPECT_EQ(a.exponent(), -3);
+    EXPECT_EQ((a + b).to_fraction().to_string(), "-157/8");
+    EXPECT_EQ((a - b).to_fraction().to_string(), "163/8");
+    EXPECT_EQ((a * b).to_fraction().to_string(), "-15/2");
+    EXPECT_EQ((b >> 10).to_fraction().to_string(), "-5/256");
+    EXPECT_TRUE(b < a);
+    EXPECT_TRUE(dyadic(fraction(-3_bi, 8_bi)) == -a);
+    EXPECT_THROW(dyadic(fraction(1_bi, 3_bi)), std::invalid_argument);
+    EXPECT_EQ(dyadic::approximate(fraction(-1_bi, 3_bi), 4).to_fraction().to_string(), "-3/8");
+    logger->debug((a + b).to_fraction().to_string());
+}
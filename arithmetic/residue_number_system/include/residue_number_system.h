@@ -0,0 +1,130 @@
+#ifndef MP_OS_RESIDUE_NUMBER_SYSTEM_H
+#define MP_OS_RESIDUE_NUMBER_SYSTEM_H
+
+#include <vector>
+#include <memory>
+#include <span>
+#include <cstdint>
+#include <big_int.h>
+
+/** Set of pairwise coprime 62-bit primes together with precomputed CRT data.
+ *  Values in range [-(M - 1) / 2, (M - 1) / 2], where M is product of moduli, are representable.
+ */
+class rns_basis final
+{
+
+private:
+
+    std::vector<uint64_t> _moduli;
+
+    /** _inverses[i] = (M / m_i)^-1 mod m_i
+     */
+    std::vector<uint64_t> _inverses;
+
+    /** Product tree: level 0 holds moduli, last level holds M.
+     *  Odd node of level is carried to the next level unchanged.
+     */
+    std::vector<std::vector<big_int>> _product_tree;
+
+    big_int _half_product;
+
+public:
+
+    /** Picks moduli_count greatest primes below 2^62
+     */
+    explicit rns_basis(size_t moduli_count);
+
+    /** Basis large enough for any value with absolute value below 2^bits
+     */
+    static std::shared_ptr<const rns_basis> for_bits(size_t bits);
+
+public:
+
+    size_t size() const noexcept;
+
+    uint64_t modulus(size_t index) const noexcept;
+
+    std::vector<uint64_t> const &moduli() const noexcept;
+
+    big_int const &product() const noexcept;
+
+public:
+
+    /** Remainder tree descent: value is reduced by products of halves of basis,
+     *  so only leaves work with word-sized operands
+     */
+    std::vector<uint64_t> to_residues(big_int const &value) const;
+
+    /** CRT reconstruction through product tree, result is in symmetric range
+     */
+    big_int from_residues(std::span<const uint64_t> residues) const;
+
+private:
+
+    void reduce_down(big_int const &value, size_t level, size_t index, std::vector<uint64_t> &residues) const;
+
+    big_int combine_up(std::span<const uint64_t> scaled, size_t level, size_t index) const;
+
+};
+
+/** Integer stored as residues modulo rns_basis. Add, subtract and multiply work
+ *  independently per residue, the value is reconstructed only by to_big_int.
+ *  Overflow of the basis range is not detected.
+ */
+class rns_int final
+{
+
+private:
+
+    std::shared_ptr<const rns_basis> _basis;
+    std::vector<uint64_t> _residues;
+
+public:
+
+    explicit rns_int(std::shared_ptr<const rns_basis> basis);
+
+    rns_int(big_int const &value, std::shared_ptr<const rns_basis> basis);
+
+    rns_int(std::vector<uint64_t> &&residues, std::shared_ptr<const rns_basis> basis);
+
+public:
+
+    static std::vector<rns_int> from_big_ints(std::span<const big_int> values, std::shared_ptr<const rns_basis> const &basis);
+
+    static std::vector<big_int> to_big_ints(std::span<const rns_int> values);
+
+    big_int to_big_int() const;
+
+public:
+
+    rns_int &operator+=(rns_int const &other) &;
+
+    rns_int operator+(rns_int const &other) const;
+
+    rns_int &operator-=(rns_int const &other) &;
+
+    rns_int operator-(rns_int const &other) const;
+
+    rns_int &operator*=(rns_int const &other) &;
+
+    rns_int operator*(rns_int const &other) const;
+
+    rns_int operator-() const;
+
+    /** Values of different bases are not comparable, as for arithmetic
+     */
+    bool operator==(rns_int const &other) const;
+
+public:
+
+    std::vector<uint64_t> const &residues() const noexcept;
+
+    std::shared_ptr<const rns_basis> const &basis() const noexcept;
+
+private:
+
+    void check_basis(rns_int const &other) const;
+
+};
+
+#endif //MP_OS_RESIDUE_NUMBER_SYSTEM_H
@@ -0,0 +1,407 @@
+#include "../include/residue_number_system.h"
+#include <stdexcept>
+
+namespace
+{
+    constexpr uint64_t MODULUS_BOUND = 1ull << 62;
+    constexpr size_t MODULUS_BITS = 61;
+
+    inline uint64_t add_mod(uint64_t a, uint64_t b, uint64_t m) noexcept
+    {
+        uint64_t sum = a + b;
+        return sum >= m ? sum - m : sum;
+    }
+
+    inline uint64_t sub_mod(uint64_t a, uint64_t b, uint64_t m) noexcept
+    {
+        return a >= b ? a - b : a + (m - b);
+    }
+
+    inline uint64_t mul_mod(uint64_t a, uint64_t b, uint64_t m) noexcept
+    {
+        return static_cast<uint64_t>(static_cast<unsigned __int128>(a) * b % m);
+    }
+
+    uint64_t pow_mod(uint64_t base, uint64_t degree, uint64_t m) noexcept
+    {
+        uint64_t result = 1;
+        base %= m;
+
+        while (degree > 0)
+        {
+            if (degree & 1)
+            {
+                result = mul_mod(result, base, m);
+            }
+            base = mul_mod(base, base, m);
+            degree >>= 1;
+        }
+
+        return result;
+    }
+
+    /** Deterministic Miller-Rabin for 64-bit numbers
+     */
+    bool is_prime(uint64_t n) noexcept
+    {
+        if (n < 2)
+        {
+            return false;
+        }
+
+        for (uint64_t p : {2ull, 3ull, 5ull, 7ull, 11ull, 13ull, 17ull, 19ull, 23ull, 29ull, 31ull, 37ull})
+        {
+            if (n % p == 0)
+            {
+                return n == p;
+            }
+        }
+
+        uint64_t d = n - 1;
+        size_t s = 0;
+        while ((d & 1) == 0)
+        {
+            d >>= 1;
+            ++s;
+        }
+
+        for (uint64_t a : {2ull, 325ull, 9375ull, 28178ull, 450775ull, 9780504ull, 1795265022ull})
+        {
+            uint64_t x = pow_mod(a, d, n);
+            if (x == 0 || x == 1 || x == n - 1)
+            {
+                continue;
+            }
+
+            bool composite = true;
+            for (size_t r = 1; r < s; ++r)
+            {
+                x = mul_mod(x, x, n);
+                if (x == n - 1)
+                {
+                    composite = false;
+                    break;
+                }
+            }
+
+            if (composite)
+            {
+                return false;
+            }
+        }
+
+        return true;
+    }
+}
+
+rns_basis::rns_basis(size_t moduli_count)
+{
+    if (moduli_count == 0)
+    {
+        throw std::invalid_argument("Basis must contain at least one modulus");
+    }
+
+    _moduli.reserve(moduli_count);
+    for (uint64_t candidate = MODULUS_BOUND - 1; _moduli.size() < moduli_count; candidate -= 2)
+    {
+        if (is_prime(candidate))
+        {
+            _moduli.push_back(candidate);
+        }
+    }
+
+    _inverses.reserve(moduli_count);
+    for (size_t i = 0; i < moduli_count; ++i)
+    {
+        uint64_t cofactor = 1;
+        for (size_t j = 0; j < moduli_count; ++j)
+        {
+            if (j != i)
+            {
+                cofactor = mul_mod(cofactor, _moduli[j] % _moduli[i], _moduli[i]);
+            }
+        }
+        _inverses.push_back(pow_mod(cofactor, _moduli[i] - 2, _moduli[i]));
+    }
+
+    _product_tree.emplace_back(_moduli.begin(), _moduli.end());
+    while (_product_tree.back().size() > 1)
+    {
+        auto const &previous = _product_tree.back();
+        std::vector<big_int> level;
+        level.reserve((previous.size() + 1) / 2);
+
+        for (size_t i = 0; i < previous.size(); i += 2)
+        {
+            level.push_back(i + 1 < previous.size() ? previous[i] * previous[i + 1] : previous[i]);
+        }
+
+        _product_tree.push_back(std::move(level));
+    }
+
+    _half_product = product() >> 1;
+}
+
+std::shared_ptr<const rns_basis> rns_basis::for_bits(size_t bits)
+{
+    return std::make_shared<const rns_basis>(bits / MODULUS_BITS + 1);
+}
+
+size_t rns_basis::size() const noexcept
+{
+    return _moduli.size();
+}
+
+uint64_t rns_basis::modulus(size_t index) const noexcept
+{
+    return _moduli[index];
+}
+
+std::vector<uint64_t> const &rns_basis::moduli() const noexcept
+{
+    return _moduli;
+}
+
+big_int const &rns_basis::product() const noexcept
+{
+    return _product_tree.back().front();
+}
+
+std::vector<uint64_t> rns_basis::to_residues(big_int const &value) const
+{
+    std::vector<uint64_t> residues(_moduli.size(), 0);
+
+    if (value.is_zero())
+    {
+        return residues;
+    }
+
+    reduce_down(value.is_negative() ? -value : value, _product_tree.size() - 1, 0, residues);
+
+    if (value.is_negative())
+    {
+        for (size_t i = 0; i < residues.size(); ++i)
+        {
+            residues[i] = sub_mod(0, residues[i], _moduli[i]);
+        }
+    }
+
+    return residues;
+}
+
+void rns_basis::reduce_down(big_int const &value, size_t level, size_t index, std::vector<uint64_t> &residues) const
+{
+    if (level == 0)
+    {
+        residues[index] = value.mod_word(_moduli[index]);
+        return;
+    }
+
+    auto const &children = _product_tree[level - 1];
+
+    for (size_t child = 2 * index; child < children.size() && child <= 2 * index + 1; ++child)
+    {
+        if (level == 1 || value.cmp_abs(children[child]) == std::strong_ordering::less)
+        {
+            reduce_down(value, level - 1, child, residues);
+        }
+        else
+        {
+            reduce_down(value % children[child], level - 1, child, residues);
+        }
+    }
+}
+
+big_int rns_basis::from_residues(std::span<const uint64_t> residues) const
+{
+    if (residues.size() != _moduli.size())
+    {
+        throw std::invalid_argument("Residues count does not match basis size");
+    }
+
+    std::vector<uint64_t> scaled(residues.size());
+    for (size_t i = 0; i < residues.size(); ++i)
+    {
+        scaled[i] = mul_mod(residues[i], _inverses[i], _moduli[i]);
+    }
+
+    big_int result = combine_up(scaled, _product_tree.size() - 1, 0) % product();
+
+    if (result > _half_product)
+    {
+        result -= product();
+    }
+
+    return result;
+}
+
+big_int rns_basis::combine_up(std::span<const uint64_t> scaled, size_t level, size_t index) const
+{
+    if (level == 0)
+    {
+        return big_int(scaled[index]);
+    }
+
+    auto const &children = _product_tree[level - 1];
+    big_int left = combine_up(scaled, level - 1, 2 * index);
+
+    if (2 * index + 1 == children.size())
+    {
+        return left;
+    }
+
+    big_int right = combine_up(scaled, level - 1, 2 * index + 1);
+
+    left *= children[2 * index + 1];
+    right *= children[2 * index];
+    left += right;
+
+    return left;
+}
+
+rns_int::rns_int(std::shared_ptr<const rns_basis> basis)
+        : _basis(std::move(basis)), _residues(_basis->size(), 0)
+{
+}
+
+rns_int::rns_int(big_int const &value, std::shared_ptr<const rns_basis> basis)
+        : _basis(std::move(basis)), _residues(_basis->to_residues(value))
+{
+}
+
+rns_int::rns_int(std::vector<uint64_t> &&residues, std::shared_ptr<const rns_basis> basis)
+        : _basis(std::move(basis)), _residues(std::move(residues))
+{
+    if (_residues.size() != _basis->size())
+    {
+        throw std::invalid_argument("Residues count does not match basis size");
+    }
+}
+
+std::vector<rns_int> rns_int::from_big_ints(std::span<const big_int> values, std::shared_ptr<const rns_basis> const &basis)
+{
+    std::vector<rns_int> result;
+    result.reserve(values.size());
+
+    for (auto const &value : values)
+    {
+        result.emplace_back(value, basis);
+    }
+
+    return result;
+}
+
+std::vector<big_int> rns_int::to_big_ints(std::span<const rns_int> values)
+{
+    std::vector<big_int> result;
+    result.reserve(values.size());
+
+    for (auto const &value : values)
+    {
+        result.push_back(value.to_big_int());
+    }
+
+    return result;
+}
+
+big_int rns_int::to_big_int() const
+{
+    return _basis->from_residues(_residues);
+}
+
+void rns_int::check_basis(rns_int const &other) const
+{
+    if (_basis != other._basis && _basis->moduli() != other._basis->moduli())
+    {
+        throw std::logic_error("Operands have different residue bases");
+    }
+}
+
+rns_int &rns_int::operator+=(rns_int const &other) &
+{
+    check_basis(other);
+    auto const &moduli = _basis->moduli();
+
+    for (size_t i = 0; i < _residues.size(); ++i)
+    {
+        _residues[i] = add_mod(_residues[i], other._residues[i], moduli[i]);
+    }
+
+    return *this;
+}
+
+rns_int rns_int::operator+(rns_int const &other) const
+{
+    rns_int result = *this;
+    result += other;
+    return result;
+}
+
+rns_int &rns_int::operator-=(rns_int const &other) &
+{
+    check_basis(other);
+    auto const &moduli = _basis->moduli();
+
+    for (size_t i = 0; i < _residues.size(); ++i)
+    {
+        _residues[i] = sub_mod(_residues[i], other._residues[i], moduli[i]);
+    }
+
+    return *this;
+}
+
+rns_int rns_int::operator-(rns_int const &other) const
+{
+    rns_int result = *this;
+    result -= other;
+    return result;
+}
+
+rns_int &rns_int::operator*=(rns_int const &other) &
+{
+    check_basis(other);
+    auto const &moduli = _basis->moduli();
+
+    for (size_t i = 0; i < _residues.size(); ++i)
+    {
+        _residues[i] = mul_mod(_residues[i], other._residues[i], moduli[i]);
+    }
+
+    return *this;
+}
+
+rns_int rns_int::operator*(rns_int const &other) const
+{
+    rns_int result = *this;
+    result *= other;
+    return result;
+}
+
+rns_int rns_int::operator-() const
+{
+    rns_int result = *this;
+    auto const &moduli = _basis->moduli();
+
+    for (size_t i = 0; i < result._residues.size(); ++i)
+    {
+        result._residues[i] = sub_mod(0, result._residues[i], moduli[i]);
+    }
+
+    return result;
+}
+
+bool rns_int::operator==(rns_int const &other) const
+{
+    check_basis(other);
+    return _residues == other._residues;
+}
+
+std::vector<uint64_t> const &rns_int::residues() const noexcept
+{
+    return _residues;
+}
+
+std::shared_ptr<const rns_basis> const &rns_int::basis() const noexcept
+{
+    return _basis;
+}
@@ -0,0 +1,117 @@
+#include <gtest/gtest.h>
+
+#include <residue_number_system.h>
+#include <client_logger.h>
+#include <client_logger_builder.h>
+
+logger *create_logger(
+    std::vector<std::pair<std::string, logger::severity>> const &output_file_streams_setup,
+    bool use_console_stream = true,
+    logger::severity console_stream_severity = logger::severity::debug)
+{
+    logger_builder *builder = new client_logger_builder();
+
+    if (use_console_stream)
+    {
+        builder->add_console_stream(console_stream_severity);
+    }
+
+    for (auto &output_file_stream_setup: output_file_streams_setup)
+    {
+        builder->add_file_stream(output_file_stream_setup.first, output_file_stream_setup.second);
+    }
+
+    logger *built_logger = builder->build();
+
+    delete builder;
+
+    return built_logger;
+}
+
+TEST(positive_tests_rns, test1)
+{
+    logger *logger = create_logger(std::vector<std::pair<std::string, logger::severity>>
+        {
+            {
+                "bigint_logs.txt",
+                logger::severity::information
+            },
+        });
+
+    auto basis = rns_basis::for_bits(256);
+
+    big_int bigint_1("-32850346459076457453464575686784654");
+    big_int bigint_2("423534596495087569087908753095322");
+
+    rns_int rns_1(bigint_1, basis);
+    rns_int rns_2(bigint_2, basis);
+
+    EXPECT_TRUE(rns_1.to_big_int() == bigint_1);
+    EXPECT_TRUE((rns_1 + rns_2).to_big_int() == bigint_1 + bigint_2);
+    EXPECT_TRUE((rns_1 - rns_2).to_big_int() == bigint_1 - bigint_2);
+    EXPECT_TRUE((rns_1 * rns_2).to_big_int() == bigint_1 * bigint_2);
+    EXPECT_TRUE((-rns_1).to_big_int() == -bigint_1);
+
+    delete logger;
+}
+
+TEST(positive_tests_rns, test2)
+{
+    logger *logger = create_logger(std::vector<std::pair<std::string, logger::severity>>
+        {
+            {
+                "bigint_logs.txt",
+                logger::severity::information
+            },
+        });
+
+    auto basis = rns_basis::for_bits(128);
+
+    // 2x2 determinant: a * d - b * c
+    std::vector<big_int> values{
+        big_int("98765432109876543210"),
+        big_int("-12345678901234567890"),
+        big_int("11111111111111111111"),
+        big_int("-22222222222222222222")};
+
+    auto residues = rns_int::from_big_ints(values, basis);
+    rns_int det = residues[0] * residues[3] - residues[1] * residues[2];
+
+    EXPECT_TRUE(det.to_big_int() == values[0] * values[3] - values[1] * values[2]);
+
+    auto restored = rns_int::to_big_ints(residues);
+    for (size_t i = 0; i < values.size(); ++i)
+    {
+        EXPECT_TRUE(restored[i] == values[i]);
+    }
+
+    delete logger;
+}
+
+TEST(negative_tests_rns, test1)
+{
+    logger *logger = create_logger(std::vector<std::pair<std::string, logger::severity>>
+        {
+            {
+                "bigint_logs.txt",
+                logger::severity::information
+            },
+        });
+
+    rns_int rns_1(1_bi, rns_basis::for_bits(64));
+    rns_int rns_2(1_bi, rns_basis::for_bits(256));
+
+    EXPECT_THROW(rns_1 += rns_2, std::logic_error);
+    EXPECT_THROW(static_cast<void>(rns_1 == rns_2), std::logic_error);
+
+    delete logger;
+}
+
+int main(
+    int argc,
+    char **argv)
+{
+    testing::InitGoogleTest(&argc, argv);
+
+    return RUN_ALL_TESTS();
+}
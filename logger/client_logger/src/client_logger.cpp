@@ -57,6 +57,13 @@ logger& client_logger::log(
     return *this;
 }
 
+bool client_logger::is_enabled(
+        logger::severity severity) const noexcept
+{
+    auto it = _output_streams.find(severity);
+    return it != _output_streams.end() && (it->second.second || !it->second.first.empty());
+}
+
 std::string client_logger::make_format(const std::string &message, severity sev) const
 {
     try {
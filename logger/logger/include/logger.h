@@ -28,6 +28,11 @@ public:
         std::string const &message,
         logger::severity severity) & = 0;
 
+    /** Whether messages of severity reach any stream, so callers may skip building them
+     */
+    [[nodiscard]] virtual bool is_enabled(
+        logger::severity severity) const noexcept;
+
 public:
 
     logger& trace(
@@ -2,6 +2,14 @@
 #define MATH_PRACTICE_AND_OPERATING_SYSTEMS_LOGGER_GUARDANT_H
 
 #include "logger.h"
+#include <concepts>
+#include <functional>
+#include <string>
+
+/** Callable building log message, invoked only if message is going to be written
+ */
+template<typename F>
+concept lazy_log_message = std::invocable<F&> && std::convertible_to<std::invoke_result_t<F&>, std::string>;
 
 class logger_guardant
 {
@@ -34,10 +42,119 @@ public:
     logger_guardant &critical_with_guard(
         std::string const &message) &;
 
+    /** Overloads for string literals: std::string is built only if message is going to be written
+     */
+    logger_guardant &log_with_guard(
+        char const *message,
+        logger::severity severity) &;
+
+    logger_guardant &trace_with_guard(
+        char const *message) &;
+
+    logger_guardant &debug_with_guard(
+        char const *message) &;
+
+    logger_guardant &information_with_guard(
+        char const *message) &;
+
+    logger_guardant &warning_with_guard(
+        char const *message) &;
+
+    logger_guardant &error_with_guard(
+        char const *message) &;
+
+    logger_guardant &critical_with_guard(
+        char const *message) &;
+
+    template<lazy_log_message F>
+    logger_guardant &log_with_guard(
+        F &&make_message,
+        logger::severity severity) &;
+
+    template<lazy_log_message F>
+    logger_guardant &trace_with_guard(
+        F &&make_message) &;
+
+    template<lazy_log_message F>
+    logger_guardant &debug_with_guard(
+        F &&make_message) &;
+
+    template<lazy_log_message F>
+    logger_guardant &information_with_guard(
+        F &&make_message) &;
+
+    template<lazy_log_message F>
+    logger_guardant &warning_with_guard(
+        F &&make_message) &;
+
+    template<lazy_log_message F>
+    logger_guardant &error_with_guard(
+        F &&make_message) &;
+
+    template<lazy_log_message F>
+    logger_guardant &critical_with_guard(
+        F &&make_message) &;
+
 protected:
 
     inline virtual logger *get_logger() const = 0;
 
 };
 
+template<lazy_log_message F>
+logger_guardant &logger_guardant::log_with_guard(
+    F &&make_message,
+    logger::severity severity) &
+{
+    logger *got_logger = get_logger();
+    if (got_logger != nullptr && got_logger->is_enabled(severity))
+    {
+        got_logger->log(std::invoke(make_message), severity);
+    }
+
+    return *this;
+}
+
+template<lazy_log_message F>
+logger_guardant &logger_guardant::trace_with_guard(
+    F &&make_message) &
+{
+    return log_with_guard(std::forward<F>(make_message), logger::severity::trace);
+}
+
+template<lazy_log_message F>
+logger_guardant &logger_guardant::debug_with_guard(
+    F &&make_message) &
+{
+    return log_with_guard(std::forward<F>(make_message), logger::severity::debug);
+}
+
+template<lazy_log_message F>
+logger_guardant &logger_guardant::information_with_guard(
+    F &&make_message) &
+{
+    return log_with_guard(std::forward<F>(make_message), logger::severity::information);
+}
+
+template<lazy_log_message F>
+logger_guardant &logger_guardant::warning_with_guard(
+    F &&make_message) &
+{
+    return log_with_guard(std::forward<F>(make_message), logger::severity::warning);
+}
+
+template<lazy_log_message F>
+logger_guardant &logger_guardant::error_with_guard(
+    F &&make_message) &
+{
+    return log_with_guard(std::forward<F>(make_message), logger::severity::error);
+}
+
+template<lazy_log_message F>
+logger_guardant &logger_guardant::critical_with_guard(
+    F &&make_message) &
+{
+    return log_with_guard(std::forward<F>(make_message), logger::severity::critical);
+}
+
 #endif //MATH_PRACTICE_AND_OPERATING_SYSTEMS_LOGGER_GUARDANT_H
\ No newline at end of file